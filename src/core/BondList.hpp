@@ -210,6 +210,14 @@ public:
     return static_cast<size_type>(std::distance(begin(), end()));
   }
 
+  /**
+   * @brief Heap memory held by the list.
+   * @return The size of the allocated storage in bytes.
+   */
+  std::size_t memory_usage() const {
+    return m_storage.capacity() * sizeof(storage_type::value_type);
+  }
+
   /**
    * @brief Erase all bonds from the list.
    */
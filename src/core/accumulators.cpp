@@ -23,6 +23,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <limits>
 #include <vector>
 
@@ -52,6 +53,14 @@ void auto_update(int steps) {
   }
 }
 
+std::size_t auto_update_memory_usage() {
+  return boost::accumulate(
+      auto_update_accumulators, std::size_t{0u},
+      [](std::size_t bytes, AutoUpdateAccumulator const &acc) {
+        return bytes + acc.acc->memory_usage();
+      });
+}
+
 int auto_update_next_update() {
   return boost::accumulate(auto_update_accumulators,
                            std::numeric_limits<int>::max(),
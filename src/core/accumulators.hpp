@@ -21,6 +21,8 @@
 
 #include "accumulators/AccumulatorBase.hpp"
 
+#include <cstddef>
+
 namespace Accumulators {
 /**
  * @brief Update accumulators.
@@ -33,6 +35,8 @@ void auto_update(int steps);
 int auto_update_next_update();
 void auto_update_add(AccumulatorBase *);
 void auto_update_remove(AccumulatorBase *);
+/** @brief Heap memory of the automatically updated accumulators, in bytes. */
+std::size_t auto_update_memory_usage();
 
 } // namespace Accumulators
 
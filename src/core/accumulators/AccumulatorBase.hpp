@@ -34,6 +34,8 @@ public:
   virtual void update() = 0;
   /** Dimensions needed to reshape the flat array returned by the accumulator */
   virtual std::vector<std::size_t> shape() const = 0;
+  /** Heap memory of the accumulated data, in bytes */
+  virtual std::size_t memory_usage() const = 0;
 
 private:
   // Number of timesteps between automatic updates.
@@ -19,6 +19,7 @@
 #include "Correlator.hpp"
 
 #include "integrate.hpp"
+#include "memory_usage.hpp"
 
 #include <utils/Vector.hpp>
 #include <utils/math/sqr.hpp>
@@ -553,4 +554,21 @@ void Correlator::set_internal_state(std::string const &state) {
   ia >> n_data;
 }
 
+std::size_t Correlator::memory_usage() const {
+  auto bytes = (A.num_elements() + B.num_elements()) *
+                   sizeof(std::vector<double>) +
+               result.num_elements() * sizeof(double);
+  for (auto it = A.data(); it != A.data() + A.num_elements(); ++it) {
+    bytes += MemoryUsage::heap_size(*it);
+  }
+  for (auto it = B.data(); it != B.data() + B.num_elements(); ++it) {
+    bytes += MemoryUsage::heap_size(*it);
+  }
+  return bytes + MemoryUsage::heap_size(tau) +
+         MemoryUsage::heap_size(n_sweeps) + MemoryUsage::heap_size(n_vals) +
+         MemoryUsage::heap_size(newest) +
+         MemoryUsage::heap_size(A_accumulated_average) +
+         MemoryUsage::heap_size(B_accumulated_average);
+}
+
 } // namespace Accumulators
@@ -194,6 +194,7 @@ public:
     shape.insert(shape.begin(), n_values());
     return shape;
   }
+  std::size_t memory_usage() const override;
   std::vector<int> get_samples_sizes() const {
     return {n_sweeps.begin(), n_sweeps.end()};
   }
@@ -27,6 +27,7 @@
 #include <boost/serialization/string.hpp>
 #include <boost/serialization/vector.hpp>
 
+#include <cstddef>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -36,6 +37,10 @@ void MeanVarianceCalculator::update() { m_acc(m_obs->operator()()); }
 
 std::vector<double> MeanVarianceCalculator::mean() { return m_acc.mean(); }
 
+std::size_t MeanVarianceCalculator::memory_usage() const {
+  return m_obs->n_values() * sizeof(::Utils::AccumulatorData<double>);
+}
+
 std::vector<double> MeanVarianceCalculator::variance() {
   return m_acc.variance();
 }
@@ -47,6 +47,7 @@ public:
   std::string get_internal_state() const;
   void set_internal_state(std::string const &);
   std::vector<std::size_t> shape() const override { return m_obs->shape(); }
+  std::size_t memory_usage() const override;
 
 private:
   std::shared_ptr<Observables::Observable> m_obs;
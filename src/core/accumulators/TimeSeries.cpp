@@ -18,18 +18,29 @@
  */
 #include "TimeSeries.hpp"
 
+#include "memory_usage.hpp"
+
 #include <boost/archive/binary_iarchive.hpp>
 #include <boost/archive/binary_oarchive.hpp>
 #include <boost/iostreams/device/array.hpp>
 #include <boost/iostreams/stream.hpp>
 #include <boost/serialization/vector.hpp>
 
+#include <cstddef>
 #include <sstream>
 #include <string>
 
 namespace Accumulators {
 void TimeSeries::update() { m_data.emplace_back(m_obs->operator()()); }
 
+std::size_t TimeSeries::memory_usage() const {
+  auto bytes = MemoryUsage::heap_size(m_data);
+  for (auto const &values : m_data) {
+    bytes += MemoryUsage::heap_size(values);
+  }
+  return bytes;
+}
+
 std::string TimeSeries::get_internal_state() const {
   std::stringstream ss;
   boost::archive::binary_oarchive oa(ss);
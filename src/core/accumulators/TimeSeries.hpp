@@ -54,6 +54,7 @@ public:
     shape.insert(shape.end(), obs_shape.begin(), obs_shape.end());
     return shape;
   }
+  std::size_t memory_usage() const override;
   void clear() { m_data.clear(); }
 
 private:
@@ -29,6 +29,7 @@
 #include "cell_system/CellStructureType.hpp"
 #include "grid.hpp"
 #include "lees_edwards/lees_edwards.hpp"
+#include "memory_usage.hpp"
 
 #include <utils/contains.hpp>
 
@@ -36,6 +37,7 @@
 #include <boost/variant.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <memory>
 #include <set>
@@ -219,6 +221,41 @@ Utils::Vector3d CellStructure::max_range() const {
   return decomposition().max_range();
 }
 
+/** @brief Heap memory of the particles of a set of cells, in bytes. */
+static std::size_t memory_usage_cells(Utils::Span<Cell *> cells) {
+  std::size_t bytes = 0;
+  for (auto const cell : cells) {
+    bytes += cell->particles().capacity() * sizeof(Particle);
+    for (auto const &p : cell->particles()) {
+      bytes += p.bonds().memory_usage();
+#ifdef EXCLUSIONS
+      bytes += MemoryUsage::heap_size(p.exclusions());
+#endif
+    }
+  }
+  return bytes;
+}
+
+std::size_t CellStructure::memory_usage_local_particles() {
+  return memory_usage_cells(decomposition().local_cells());
+}
+
+std::size_t CellStructure::memory_usage_ghost_particles() {
+  return memory_usage_cells(decomposition().ghost_cells());
+}
+
+std::size_t CellStructure::memory_usage_pair_lists() const {
+  return MemoryUsage::heap_size(m_verlet_list) +
+         MemoryUsage::heap_size(m_verlet_inner_list) +
+         MemoryUsage::heap_size(m_prune_positions) +
+         MemoryUsage::heap_size(m_clusters) +
+         MemoryUsage::heap_size(m_cluster_pair_list);
+}
+
+std::size_t CellStructure::memory_usage_particle_index() const {
+  return MemoryUsage::heap_size(m_particle_index);
+}
+
 namespace {
 /**
  * @brief Apply a @ref ParticleChange to a particle index.
@@ -36,6 +36,7 @@
 #include "config/config.hpp"
 #include "ghosts.hpp"
 
+#include <utils/Vector.hpp>
 #include <utils/math/sqr.hpp>
 
 #include <boost/container/static_vector.hpp>
@@ -45,11 +46,14 @@
 #include <boost/range/algorithm/transform.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstddef>
 #include <iterator>
 #include <memory>
 #include <set>
 #include <stdexcept>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -60,6 +64,19 @@ enum Resort : unsigned {
   RESORT_GLOBAL = 2u
 };
 
+/**
+ * @brief Reasons of a particle resort, i.e. of a pair list rebuild.
+ *
+ * They are stored in the bits above the @ref Resort level, such that
+ * they are reduced over all MPI ranks together with the resort level.
+ */
+enum RebuildReason : unsigned {
+  REBUILD_DISPLACEMENT = 4u,
+  REBUILD_BOX_CHANGE = 8u,
+  REBUILD_PARTICLE_CHANGE = 16u,
+  REBUILD_CELL_SYSTEM_CHANGE = 32u
+};
+
 /**
  * @brief Flags to select particle parts for communication.
  */
@@ -108,6 +125,19 @@ struct Distance {
   double dist2;
 };
 
+/**
+ * @brief Group of spatially close particles from the same cell.
+ *
+ * Clusters are the building blocks of the cluster pair list: pairs are
+ * stored between clusters instead of between particles, and each cluster
+ * pair is evaluated as a dense tile of particle pairs.
+ */
+struct ParticleCluster {
+  static constexpr std::size_t max_size = 8;
+  std::array<Particle *, max_size> particles;
+  std::size_t size = 0;
+};
+
 namespace detail {
 // NOLINTNEXTLINE(bugprone-exception-escape)
 struct MinimalImageDistance {
@@ -145,12 +175,41 @@ private:
   unsigned m_resort_particles = Cells::RESORT_NONE;
   bool m_rebuild_verlet_list = true;
   std::vector<std::pair<Particle *, Particle *>> m_verlet_list;
+  /** Skin of the inner pair list, or 0 for a single pair list. */
+  double m_verlet_inner_skin = 0.;
+  /** Pairs of @ref m_verlet_list within the inner skin. */
+  std::vector<std::pair<Particle *, Particle *>> m_verlet_inner_list;
+  /** Positions of the local and ghost particles at the last pruning. */
+  std::vector<Utils::Vector3d> m_prune_positions;
+  /** Number of prunings of the inner pair list. */
+  std::size_t m_verlet_prune_count = 0;
+  /** Number of resorts, and number of resorts per @ref Cells::RebuildReason
+   *  in the order of their bits.
+   */
+  std::size_t m_rebuild_count = 0;
+  std::array<std::size_t, 4> m_rebuild_reason_counts = {};
+  /** Number of particles per cluster, or 1 for a particle pair list. */
+  int m_verlet_cluster_size = 1;
+  /** Clusters of the cluster pair list. */
+  std::vector<ParticleCluster> m_clusters;
+  /** Interacting pairs of clusters, as indices in @ref m_clusters. */
+  std::vector<std::pair<std::size_t, std::size_t>> m_cluster_pair_list;
   double m_le_pos_offset_at_last_resort = 0.;
 
 public:
   CellStructure(BoxGeometry const &box);
 
   bool use_verlet_list = true;
+  /** Ratio between the minimal cell size of the regular decomposition
+   *  and the interaction range. Values larger than 1 yield fewer but
+   *  larger cells.
+   */
+  double cell_size_factor = 1.;
+  /** Evaluate the Lennard-Jones and WCA pair force factors in single
+   *  precision. Distances are rounded to single precision, forces are
+   *  accumulated in double precision.
+   */
+  bool use_mixed_precision = false;
 
   /**
    * @brief Update local particle index.
@@ -361,6 +420,15 @@ public:
     assert(m_resort_particles >= level);
   }
 
+  /**
+   * @brief Increase the local resort level at least to @p level,
+   * and record the reason of the resort.
+   */
+  void set_resort_particles(Cells::Resort level, Cells::RebuildReason reason) {
+    set_resort_particles(level);
+    m_resort_particles |= reason;
+  }
+
   /**
    * @brief Get the currently scheduled resort level.
    */
@@ -391,6 +459,139 @@ public:
         });
   }
 
+  /**
+   * @brief Set the number of particles per cluster in the Verlet list.
+   *
+   * With a cluster size of 1, the Verlet list stores particle pairs.
+   * With a cluster size of 4 or 8, the particles of each cell are grouped
+   * into spatially compact clusters, the Verlet list stores interacting
+   * cluster pairs, and the pair kernel is applied on dense tiles of
+   * particle pairs.
+   */
+  void set_verlet_cluster_size(int size) {
+    if (size != 1 and size != 4 and size != 8) {
+      throw std::domain_error("Verlet cluster size must be 1, 4 or 8");
+    }
+    m_verlet_cluster_size = size;
+    m_rebuild_verlet_list = true;
+  }
+
+  /** @brief Get the number of particles per cluster in the Verlet list. */
+  int get_verlet_cluster_size() const { return m_verlet_cluster_size; }
+
+  /**
+   * @brief Set the skin of the inner pair list.
+   *
+   * With a positive inner skin, the Verlet list built with the full skin
+   * is only used as an outer list. An inner list with the pairs within
+   * the interaction cutoffs plus the inner skin is pruned from it whenever
+   * a particle moved by more than half the inner skin, and the pair
+   * kernels only run over the inner list. The outer list is rebuilt as
+   * usual, when a particle moved by more than half the full skin.
+   */
+  void set_verlet_inner_skin(double inner_skin) {
+    if (inner_skin < 0.) {
+      throw std::domain_error("Verlet inner skin must be >= 0");
+    }
+    m_verlet_inner_skin = inner_skin;
+    m_rebuild_verlet_list = true;
+  }
+
+  /** @brief Get the skin of the inner pair list. */
+  double get_verlet_inner_skin() const { return m_verlet_inner_skin; }
+
+  /** @brief Get the number of prunings of the inner pair list. */
+  auto get_verlet_prune_count() const { return m_verlet_prune_count; }
+
+  /**
+   * @brief Count a resort in the rebuild statistics.
+   * @param global_resort Resort level and reasons reduced over all ranks.
+   */
+  void count_rebuild(unsigned global_resort) {
+    ++m_rebuild_count;
+    for (std::size_t i = 0; i < m_rebuild_reason_counts.size(); ++i) {
+      if (global_resort & (Cells::REBUILD_DISPLACEMENT << i)) {
+        ++m_rebuild_reason_counts[i];
+      }
+    }
+  }
+
+  /** @brief Get the number of resorts since the start of the simulation. */
+  auto get_rebuild_count() const { return m_rebuild_count; }
+
+  /** @brief Get the number of resorts with a given reason. */
+  std::size_t get_rebuild_count(Cells::RebuildReason reason) const {
+    for (std::size_t i = 0; i < m_rebuild_reason_counts.size(); ++i) {
+      if (reason == (Cells::REBUILD_DISPLACEMENT << i)) {
+        return m_rebuild_reason_counts[i];
+      }
+    }
+    return 0;
+  }
+
+  /** @brief Whether the pair lists are up-to-date with the particles. */
+  bool pair_lists_valid() const {
+    return not m_rebuild_verlet_list and
+           m_resort_particles == Cells::RESORT_NONE;
+  }
+
+  /** @brief Heap memory of the local particles, in bytes.
+   *  Includes the bond and exclusion lists of the particles.
+   */
+  std::size_t memory_usage_local_particles();
+  /** @brief Heap memory of the ghost particles, in bytes. */
+  std::size_t memory_usage_ghost_particles();
+  /** @brief Heap memory of the pair lists, in bytes. */
+  std::size_t memory_usage_pair_lists() const;
+  /** @brief Heap memory of the particle index, in bytes. */
+  std::size_t memory_usage_particle_index() const;
+
+  /** @brief Number of particles in each local cell. */
+  std::vector<std::size_t> get_local_cell_occupancies() {
+    std::vector<std::size_t> occupancies;
+    occupancies.reserve(local_cells().size());
+    for (auto const cell : local_cells()) {
+      occupancies.emplace_back(cell->particles().size());
+    }
+    return occupancies;
+  }
+
+  /** @brief Number of particle pairs in the Verlet list. */
+  auto get_verlet_list_size() const { return m_verlet_list.size(); }
+
+  /** @brief Number of particle pairs in the inner pair list. */
+  auto get_verlet_inner_list_size() const {
+    return m_verlet_inner_list.size();
+  }
+
+  /** @brief Number of cluster pairs in the cluster pair list. */
+  auto get_cluster_pair_list_size() const {
+    return m_cluster_pair_list.size();
+  }
+
+  /**
+   * @brief Count the pairs of the particle pair list used by the pair
+   * kernels that don't fulfill a criterion, e.g. the pairs beyond the
+   * interaction cutoffs. The pair lists must be valid.
+   */
+  template <class Criterion>
+  std::size_t count_listed_pairs_not_matching(Criterion const &criterion) {
+    assert(pair_lists_valid());
+    auto const &pairs =
+        (m_verlet_inner_skin > 0.) ? m_verlet_inner_list : m_verlet_list;
+    auto const count = [&pairs, &criterion](auto const &df) {
+      return static_cast<std::size_t>(std::count_if(
+          pairs.begin(), pairs.end(), [&criterion, &df](auto const &pair) {
+            auto const d = df(*pair.first, *pair.second);
+            return not criterion(*pair.first, *pair.second, d);
+          }));
+    };
+    if (decomposition().minimum_image_distance()) {
+      return count(detail::MinimalImageDistance{decomposition().box()});
+    }
+    return count(detail::EuclidianDistance{});
+  }
+
   auto get_le_pos_offset_at_last_resort() const {
     return m_le_pos_offset_at_last_resort;
   }
@@ -501,6 +702,8 @@ private:
 
     /* Swap in new cell system */
     std::swap(m_decomposition, decomposition);
+    set_resort_particles(Cells::RESORT_LOCAL,
+                         Cells::REBUILD_CELL_SYSTEM_CHANGE);
 
     /* Add particles to new system */
     for (auto &p : Cells::particles(decomposition->local_cells())) {
@@ -584,38 +787,248 @@ private:
   template <class PairKernel, class VerletCriterion>
   void verlet_list_loop(PairKernel pair_kernel,
                         const VerletCriterion &verlet_criterion) {
+    auto const dual_list = m_verlet_inner_skin > 0.;
+    auto const inner_criterion =
+        verlet_criterion.with_skin(m_verlet_inner_skin);
     /* In this case the verlet list update is attached to
      * the pair kernel, and the verlet list is rebuilt as
      * we go. */
     if (m_rebuild_verlet_list) {
       m_verlet_list.clear();
+      m_verlet_inner_list.clear();
 
       link_cell([&](Particle &p1, Particle &p2, Distance const &d) {
         if (verlet_criterion(p1, p2, d)) {
           m_verlet_list.emplace_back(&p1, &p2);
-          pair_kernel(p1, p2, d);
+          if (not dual_list) {
+            pair_kernel(p1, p2, d);
+          } else if (inner_criterion(p1, p2, d)) {
+            m_verlet_inner_list.emplace_back(&p1, &p2);
+            pair_kernel(p1, p2, d);
+          }
         }
       });
 
+      if (dual_list) {
+        save_prune_positions();
+      }
       m_rebuild_verlet_list = false;
     } else {
-      auto const maybe_box = decomposition().minimum_image_distance();
-      /* In this case the pair kernel is just run over the verlet list. */
-      if (maybe_box) {
-        auto const distance_function =
-            detail::MinimalImageDistance{decomposition().box()};
-        for (auto &pair : m_verlet_list) {
+      /* In this case the pair kernel is just run over the verlet list,
+       * or over the inner list, which is pruned first if needed. */
+      auto const run = [&](auto const &distance_function) {
+        if (dual_list and prune_required()) {
+          prune_verlet_list(inner_criterion, distance_function);
+        }
+        auto const &pairs = dual_list ? m_verlet_inner_list : m_verlet_list;
+        for (auto &pair : pairs) {
           pair_kernel(*pair.first, *pair.second,
                       distance_function(*pair.first, *pair.second));
         }
+      };
+      if (decomposition().minimum_image_distance()) {
+        run(detail::MinimalImageDistance{decomposition().box()});
       } else {
-        auto const distance_function = detail::EuclidianDistance{};
-        for (auto &pair : m_verlet_list) {
-          pair_kernel(*pair.first, *pair.second,
-                      distance_function(*pair.first, *pair.second));
+        run(detail::EuclidianDistance{});
+      }
+    }
+  }
+
+  /** Store the positions of the local and ghost particles as reference
+   *  for the displacement criterion of the inner pair list.
+   */
+  void save_prune_positions() {
+    m_prune_positions.clear();
+    for (auto const &p : local_particles()) {
+      m_prune_positions.emplace_back(p.pos());
+    }
+    for (auto const &p : ghost_particles()) {
+      m_prune_positions.emplace_back(p.pos());
+    }
+  }
+
+  /** Whether a local or ghost particle moved by more than half the inner
+   *  skin since the last pruning of the inner pair list.
+   *  Ghost positions are folded, hence the minimum image displacement.
+   */
+  bool prune_required() {
+    auto const lim = Utils::sqr(0.5 * m_verlet_inner_skin);
+    auto const &box = decomposition().box();
+    auto it = m_prune_positions.begin();
+    auto const moved = [this, &box, &it, lim](Particle const &p) {
+      return it == m_prune_positions.end() or
+             box.get_mi_vector(p.pos(), *it++).norm2() > lim;
+    };
+    auto const local = local_particles();
+    auto const ghosts = ghost_particles();
+    return std::any_of(local.begin(), local.end(), moved) or
+           std::any_of(ghosts.begin(), ghosts.end(), moved) or
+           it != m_prune_positions.end();
+  }
+
+  /** Prune the inner pair list from the outer Verlet list. */
+  template <class VerletCriterion, class DistanceFunc>
+  void prune_verlet_list(VerletCriterion const &inner_criterion,
+                         DistanceFunc const &df) {
+    m_verlet_inner_list.clear();
+    for (auto const &pair : m_verlet_list) {
+      auto const d = df(*pair.first, *pair.second);
+      if (inner_criterion(*pair.first, *pair.second, d)) {
+        m_verlet_inner_list.emplace_back(pair);
+      }
+    }
+    save_prune_positions();
+    ++m_verlet_prune_count;
+  }
+
+  /**
+   * @brief Partition the particles of a cell into clusters.
+   *
+   * Particles are sorted along the z-axis and grouped by
+   * @ref m_verlet_cluster_size.
+   *
+   * @return Index range of the new clusters in @ref m_clusters.
+   */
+  std::pair<std::size_t, std::size_t> make_clusters(Cell &cell) {
+    static std::vector<Particle *> sorted;
+    sorted.clear();
+    for (auto &p : cell.particles()) {
+      sorted.emplace_back(std::addressof(p));
+    }
+    std::sort(sorted.begin(), sorted.end(),
+              [](Particle const *a, Particle const *b) {
+                return a->pos()[2] < b->pos()[2];
+              });
+
+    auto const first = m_clusters.size();
+    auto const cluster_size =
+        static_cast<std::size_t>(m_verlet_cluster_size);
+    for (std::size_t i = 0; i < sorted.size(); i += cluster_size) {
+      ParticleCluster cluster;
+      cluster.size = std::min(cluster_size, sorted.size() - i);
+      std::copy_n(sorted.begin() + static_cast<std::ptrdiff_t>(i),
+                  cluster.size, cluster.particles.begin());
+      m_clusters.emplace_back(cluster);
+    }
+    return {first, m_clusters.size()};
+  }
+
+  /**
+   * @brief Apply a kernel on all particle pairs of a cluster pair.
+   *
+   * @param ci        First cluster.
+   * @param cj        Second cluster.
+   * @param same      Whether @p ci and @p cj are the same cluster,
+   *                  in which case each pair is only visited once.
+   * @param kernel    Callable with (Particle, Particle, Distance),
+   *                  returning true to stop the iteration.
+   * @param df        Distance function.
+   * @return Whether the iteration was stopped by the kernel.
+   */
+  template <class Kernel, class DistanceFunc>
+  static bool for_each_tile_pair(ParticleCluster const &ci,
+                                 ParticleCluster const &cj, bool same,
+                                 Kernel &&kernel, DistanceFunc const &df) {
+    for (std::size_t i = 0; i < ci.size; ++i) {
+      auto &p1 = *ci.particles[i];
+      for (std::size_t j = (same) ? i + 1 : 0; j < cj.size; ++j) {
+        auto &p2 = *cj.particles[j];
+        if (kernel(p1, p2, df(p1, p2))) {
+          return true;
         }
       }
     }
+    return false;
+  }
+
+  /**
+   * @brief Rebuild the cluster pair list.
+   *
+   * A cluster pair is stored if at least one of its particle pairs
+   * fulfills the Verlet criterion.
+   */
+  template <class VerletCriterion, class DistanceFunc>
+  void build_cluster_pair_list(VerletCriterion const &verlet_criterion,
+                               DistanceFunc const &df) {
+    m_clusters.clear();
+    m_cluster_pair_list.clear();
+
+    std::unordered_map<Cell const *, std::pair<std::size_t, std::size_t>>
+        cell_clusters;
+    auto const get_clusters = [this, &cell_clusters](Cell *cell) {
+      auto const it = cell_clusters.find(cell);
+      if (it != cell_clusters.end()) {
+        return it->second;
+      }
+      return cell_clusters[cell] = make_clusters(*cell);
+    };
+
+    auto const tile_interacts = [this, &verlet_criterion, &df](
+                                    std::size_t i, std::size_t j) {
+      return for_each_tile_pair(
+          m_clusters[i], m_clusters[j], i == j,
+          [&verlet_criterion](Particle const &p1, Particle const &p2,
+                              Distance const &d) {
+            return verlet_criterion(p1, p2, d);
+          },
+          df);
+    };
+
+    for (auto cell : local_cells()) {
+      auto const range = get_clusters(cell);
+      for (auto i = range.first; i < range.second; ++i) {
+        for (auto j = i; j < range.second; ++j) {
+          if (tile_interacts(i, j)) {
+            m_cluster_pair_list.emplace_back(i, j);
+          }
+        }
+      }
+      for (auto neighbor : cell->neighbors().red()) {
+        auto const neighbor_range = get_clusters(neighbor);
+        for (auto i = range.first; i < range.second; ++i) {
+          for (auto j = neighbor_range.first; j < neighbor_range.second; ++j) {
+            if (tile_interacts(i, j)) {
+              m_cluster_pair_list.emplace_back(i, j);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /** Non-bonded pair loop with cluster pair lists.
+   *
+   * @param pair_kernel Kernel to apply
+   * @param verlet_criterion Filter for verlet lists, also used to mask
+   *        the particle pairs of each cluster pair.
+   */
+  template <class PairKernel, class VerletCriterion>
+  void cluster_pair_loop(PairKernel pair_kernel,
+                         const VerletCriterion &verlet_criterion) {
+    auto const masked_kernel = [&pair_kernel, &verlet_criterion](
+                                   Particle &p1, Particle &p2,
+                                   Distance const &d) {
+      if (verlet_criterion(p1, p2, d)) {
+        pair_kernel(p1, p2, d);
+      }
+      return false;
+    };
+    auto const run = [&](auto const &df) {
+      if (m_rebuild_verlet_list) {
+        build_cluster_pair_list(verlet_criterion, df);
+        m_rebuild_verlet_list = false;
+      }
+      for (auto const &pair : m_cluster_pair_list) {
+        for_each_tile_pair(m_clusters[pair.first], m_clusters[pair.second],
+                           pair.first == pair.second, masked_kernel, df);
+      }
+    };
+
+    if (decomposition().minimum_image_distance()) {
+      run(detail::MinimalImageDistance{decomposition().box()});
+    } else {
+      run(detail::EuclidianDistance{});
+    }
   }
 
 public:
@@ -643,7 +1056,9 @@ public:
   template <class PairKernel, class VerletCriterion>
   void non_bonded_loop(PairKernel pair_kernel,
                        const VerletCriterion &verlet_criterion) {
-    if (use_verlet_list) {
+    if (use_verlet_list and m_verlet_cluster_size > 1) {
+      cluster_pair_loop(pair_kernel, verlet_criterion);
+    } else if (use_verlet_list) {
       verlet_list_loop(pair_kernel, verlet_criterion);
     } else {
       /* No verlet lists, just run the kernel with pairs from the cells. */
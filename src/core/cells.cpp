@@ -33,21 +33,29 @@
 #include "cell_system/HybridDecomposition.hpp"
 
 #include "Particle.hpp"
+#include "collision.hpp"
 #include "communication.hpp"
+#include "electrostatics/coulomb.hpp"
 #include "errorhandling.hpp"
 #include "event.hpp"
 #include "grid.hpp"
 #include "integrate.hpp"
+#include "magnetostatics/dipoles.hpp"
+#include "nonbonded_interactions/VerletCriterion.hpp"
 #include "particle_node.hpp"
 
 #include <utils/Vector.hpp>
 #include <utils/math/sqr.hpp>
 
 #include <boost/mpi/collectives/all_reduce.hpp>
+#include <boost/mpi/collectives/reduce.hpp>
+#include <boost/mpi/operations.hpp>
 #include <boost/range/algorithm/min_element.hpp>
 #include <boost/serialization/set.hpp>
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <functional>
 #include <stdexcept>
 #include <utility>
@@ -206,8 +214,9 @@ void set_hybrid_decomposition(std::set<int> n_square_types,
 void cells_re_init(CellStructureType new_cs) {
   switch (new_cs) {
   case CellStructureType::CELL_STRUCTURE_REGULAR:
-    cell_structure.set_regular_decomposition(comm_cart, interaction_range(),
-                                             box_geo, local_geo);
+    cell_structure.set_regular_decomposition(
+        comm_cart, interaction_range() * cell_structure.cell_size_factor,
+        box_geo, local_geo);
     break;
   case CellStructureType::CELL_STRUCTURE_NSQUARE:
     cell_structure.set_atom_decomposition(comm_cart, box_geo, local_geo);
@@ -230,22 +239,98 @@ void cells_re_init(CellStructureType new_cs) {
 }
 
 void check_resort_particles() {
-  auto const level = (cell_structure.check_resort_required(
-                         cell_structure.local_particles(), skin))
-                         ? Cells::RESORT_LOCAL
-                         : Cells::RESORT_NONE;
+  if (cell_structure.check_resort_required(cell_structure.local_particles(),
+                                           skin)) {
+    cell_structure.set_resort_particles(Cells::RESORT_LOCAL,
+                                        Cells::REBUILD_DISPLACEMENT);
+  }
+}
+
+CellSystemDiagnostics get_cell_system_diagnostics() {
+  CellSystemDiagnostics out{};
+  auto const local_occupancies = cell_structure.get_local_cell_occupancies();
+  auto const valid = cell_structure.pair_lists_valid();
+
+  std::size_t n_pairs_beyond_cutoff = 0;
+  if (valid) {
+#ifdef ELECTROSTATICS
+    auto const coulomb_cutoff = Coulomb::cutoff();
+#else
+    auto const coulomb_cutoff = INACTIVE_CUTOFF;
+#endif
+#ifdef DIPOLES
+    auto const dipole_cutoff = Dipoles::cutoff();
+#else
+    auto const dipole_cutoff = INACTIVE_CUTOFF;
+#endif
+    n_pairs_beyond_cutoff = cell_structure.count_listed_pairs_not_matching(
+        VerletCriterion<>{0., interaction_range(), coulomb_cutoff,
+                          dipole_cutoff, collision_detection_cutoff()});
+  }
+
+  std::array<std::size_t, 9> local = {
+      static_cast<std::size_t>(cell_structure.local_particles().size()),
+      static_cast<std::size_t>(cell_structure.ghost_particles().size()),
+      local_occupancies.size(),
+      valid ? std::size_t{0} : std::size_t{1},
+      cell_structure.get_verlet_list_size(),
+      cell_structure.get_verlet_inner_list_size(),
+      cell_structure.get_cluster_pair_list_size(),
+      n_pairs_beyond_cutoff,
+      cell_structure.get_verlet_prune_count()};
+  std::array<std::size_t, 9> global = {};
+  boost::mpi::reduce(comm_cart, local.data(), static_cast<int>(local.size()),
+                     global.data(), std::plus<std::size_t>(), 0);
+
+  std::size_t max_occupancy = 0;
+  for (auto const n : local_occupancies) {
+    max_occupancy = std::max(max_occupancy, n);
+  }
+  max_occupancy = boost::mpi::all_reduce(comm_cart, max_occupancy,
+                                         boost::mpi::maximum<std::size_t>());
+  std::vector<std::size_t> occupancy(max_occupancy + 1u, 0u);
+  for (auto const n : local_occupancies) {
+    ++occupancy[n];
+  }
+  out.cell_occupancy.resize(occupancy.size());
+  boost::mpi::reduce(comm_cart, occupancy.data(),
+                     static_cast<int>(occupancy.size()),
+                     out.cell_occupancy.data(), std::plus<std::size_t>(), 0);
 
-  cell_structure.set_resort_particles(level);
+  out.n_particles = global[0];
+  out.n_ghosts = global[1];
+  out.n_cells = global[2];
+  out.pair_lists_valid = (global[3] == 0u);
+  out.n_pairs = global[4];
+  out.n_inner_pairs = global[5];
+  out.n_cluster_pairs = global[6];
+  out.n_pairs_beyond_cutoff = global[7];
+  out.n_prunes = global[8];
+  /* resorts are collective, hence the rebuild statistics of all ranks
+   * are identical */
+  out.n_rebuilds = cell_structure.get_rebuild_count();
+  out.n_rebuilds_displacement =
+      cell_structure.get_rebuild_count(Cells::REBUILD_DISPLACEMENT);
+  out.n_rebuilds_box_change =
+      cell_structure.get_rebuild_count(Cells::REBUILD_BOX_CHANGE);
+  out.n_rebuilds_particle_change =
+      cell_structure.get_rebuild_count(Cells::REBUILD_PARTICLE_CHANGE);
+  out.n_rebuilds_cell_system_change =
+      cell_structure.get_rebuild_count(Cells::REBUILD_CELL_SYSTEM_CHANGE);
+  return out;
 }
 
 void cells_update_ghosts(unsigned data_parts) {
-  /* data parts that are only updated on resort */
-  auto constexpr resort_only_parts =
-      Cells::DATA_PART_PROPERTIES | Cells::DATA_PART_BONDS;
-
   auto const global_resort =
       boost::mpi::all_reduce(comm_cart, cell_structure.get_resort_particles(),
                              std::bit_or<unsigned>());
+  cells_update_ghosts(data_parts, global_resort);
+}
+
+void cells_update_ghosts(unsigned data_parts, unsigned global_resort) {
+  /* data parts that are only updated on resort */
+  auto constexpr resort_only_parts =
+      Cells::DATA_PART_PROPERTIES | Cells::DATA_PART_BONDS;
 
   if (global_resort != Cells::RESORT_NONE) {
     int global = (global_resort & Cells::RESORT_GLOBAL)
@@ -254,6 +339,7 @@ void cells_update_ghosts(unsigned data_parts) {
 
     /* Resort cell system */
     cell_structure.resort_particles(global, box_geo);
+    cell_structure.count_rebuild(global_resort);
     cell_structure.ghosts_count();
     cell_structure.ghosts_update(data_parts);
 
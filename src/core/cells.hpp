@@ -94,6 +94,13 @@ void cells_re_init(CellStructureType new_cs);
  */
 void cells_update_ghosts(unsigned data_parts);
 
+/** Update ghost information with a resort level that all MPI ranks
+ *  already agreed upon, e.g. in a collective shared with other checks.
+ *  @param data_parts     Particle data to communicate
+ *  @param global_resort  Bitwise OR of the resort levels of all ranks
+ */
+void cells_update_ghosts(unsigned data_parts, unsigned global_resort);
+
 /**
  * @brief Get pairs closer than @p distance from the cells.
  *
@@ -112,6 +119,51 @@ get_pairs_of_types(double distance, std::vector<int> const &types);
 /** Check if a particle resorting is required. */
 void check_resort_particles();
 
+/** @brief Diagnostics of the pair lists and of the cell system. */
+struct CellSystemDiagnostics {
+  /** Number of local particles. */
+  std::size_t n_particles = 0;
+  /** Number of ghost particles. */
+  std::size_t n_ghosts = 0;
+  /** Number of local cells. */
+  std::size_t n_cells = 0;
+  /** Number of local cells containing @c i particles, at index @c i. */
+  std::vector<std::size_t> cell_occupancy;
+  /** Whether the pair lists are up-to-date. Otherwise, the pair list
+   *  sizes are not meaningful.
+   */
+  bool pair_lists_valid = false;
+  /** Number of particle pairs in the Verlet list. */
+  std::size_t n_pairs = 0;
+  /** Number of particle pairs in the inner pair list. */
+  std::size_t n_inner_pairs = 0;
+  /** Number of cluster pairs in the cluster pair list. */
+  std::size_t n_cluster_pairs = 0;
+  /** Number of pairs of the particle pair list used by the pair kernels
+   *  that are beyond the interaction cutoffs.
+   */
+  std::size_t n_pairs_beyond_cutoff = 0;
+  /** Number of prunings of the inner pair list. */
+  std::size_t n_prunes = 0;
+  /** Number of resorts, i.e. of pair list rebuilds. */
+  std::size_t n_rebuilds = 0;
+  /** Number of resorts per reason. A resort can have several reasons. */
+  std::size_t n_rebuilds_displacement = 0;
+  std::size_t n_rebuilds_box_change = 0;
+  std::size_t n_rebuilds_particle_change = 0;
+  std::size_t n_rebuilds_cell_system_change = 0;
+};
+
+/**
+ * @brief Collect the diagnostics of the pair lists and of the cell system.
+ *
+ * The particle, cell and pair counts are summed over all MPI ranks, as
+ * well as the number of prunings, which each rank decides independently.
+ * The pair lists are not rebuilt. Collective call, the result is only
+ * valid on the head node.
+ */
+CellSystemDiagnostics get_cell_system_diagnostics();
+
 /**
  * @brief Get ids of particles that are within a certain distance
  * of another particle.
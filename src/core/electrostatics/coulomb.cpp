@@ -32,6 +32,7 @@
 #include "errorhandling.hpp"
 #include "grid_based_algorithms/electrokinetics.hpp"
 #include "integrate.hpp"
+#include "nonbonded_interactions/nonbonded_interaction_data.hpp"
 #include "npt.hpp"
 #include "partCfg_global.hpp"
 
@@ -49,6 +50,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstdio>
 #include <iomanip>
 #include <limits>
@@ -155,6 +157,12 @@ struct ShortRangeCutoff : public boost::static_visitor<double> {
   auto operator()(std::shared_ptr<CoulombMMM1D> const &actor) const {
     return std::numeric_limits<double>::infinity();
   }
+  auto operator()(std::shared_ptr<CoulombRBE> const &actor) const {
+    return actor->r_cut;
+  }
+  auto operator()(std::shared_ptr<CoulombFMM> const &) const {
+    return INACTIVE_CUTOFF;
+  }
 #ifdef SCAFACOS
   auto operator()(std::shared_ptr<CoulombScafacos> const &actor) const {
     return actor->get_r_cut();
@@ -175,6 +183,15 @@ double cutoff() {
   return -1.0;
 }
 
+std::size_t memory_usage() {
+#ifdef P3M
+  if (auto p3m = get_actor_by_type<CoulombP3M>(electrostatics_actor)) {
+    return p3m->p3m.memory_usage();
+  }
+#endif // P3M
+  return 0u;
+}
+
 struct EventOnObservableCalc : public boost::static_visitor<void> {
   template <typename T> void operator()(std::shared_ptr<T> const &) const {}
 
@@ -195,13 +212,50 @@ void on_observable_calc() {
   }
 }
 
+struct EventOnIntegrationStep : public boost::static_visitor<void> {
+  template <typename T> void operator()(std::shared_ptr<T> const &) const {}
+
+#ifdef P3M
+  void operator()(std::shared_ptr<CoulombP3M> const &actor) const {
+    actor->on_integration_step();
+  }
+#ifdef CUDA
+  void operator()(std::shared_ptr<CoulombP3MGPU> const &actor) const {
+    actor->on_integration_step();
+  }
+#endif // CUDA
+#endif // P3M
+};
+
+void on_integration_step() {
+  visit_active_actor_try_catch(EventOnIntegrationStep(), electrostatics_actor);
+}
+
+struct PrepareLongRangeForce : public boost::static_visitor<void> {
+  explicit PrepareLongRangeForce(ParticleRange const &particles)
+      : m_particles(particles) {}
+
+#ifdef P3M
+  void operator()(std::shared_ptr<CoulombP3M> const &actor) const {
+    actor->prepare_long_range_forces(m_particles);
+  }
+#endif // P3M
+  /* The other algorithms do all their work in LongRangeForce */
+  template <typename T> void operator()(std::shared_ptr<T> const &) const {}
+
+private:
+  ParticleRange const &m_particles;
+};
+
 struct LongRangeForce : public boost::static_visitor<void> {
   explicit LongRangeForce(ParticleRange const &particles)
       : m_particles(particles) {}
 
 #ifdef P3M
   void operator()(std::shared_ptr<CoulombP3M> const &actor) const {
-    actor->charge_assign(m_particles);
+    if (not actor->is_prepared()) {
+      actor->charge_assign(m_particles);
+    }
 #ifdef NPT
     if (integ_switch == INTEG_METHOD_NPT_ISO) {
       auto const energy = actor->long_range_kernel(true, true, m_particles);
@@ -237,6 +291,12 @@ struct LongRangeForce : public boost::static_visitor<void> {
     actor->add_long_range_forces();
   }
 #endif
+  void operator()(std::shared_ptr<CoulombRBE> const &actor) const {
+    actor->add_long_range_forces(m_particles);
+  }
+  void operator()(std::shared_ptr<CoulombFMM> const &actor) const {
+    actor->add_long_range_forces(m_particles);
+  }
   /* Several algorithms only provide near-field kernels */
   void operator()(std::shared_ptr<CoulombMMM1D> const &) const {}
   void operator()(std::shared_ptr<DebyeHueckel> const &) const {}
@@ -271,6 +331,12 @@ struct LongRangeEnergy : public boost::static_visitor<double> {
     return actor->long_range_energy();
   }
 #endif
+  auto operator()(std::shared_ptr<CoulombRBE> const &actor) const {
+    return actor->long_range_energy(m_particles);
+  }
+  auto operator()(std::shared_ptr<CoulombFMM> const &actor) const {
+    return actor->long_range_energy(m_particles);
+  }
   /* Several algorithms only provide near-field kernels */
   auto operator()(std::shared_ptr<CoulombMMM1D> const &) const { return 0.; }
   auto operator()(std::shared_ptr<DebyeHueckel> const &) const { return 0.; }
@@ -280,6 +346,13 @@ private:
   ParticleRange const &m_particles;
 };
 
+void prepare_long_range_force(ParticleRange const &particles) {
+  if (electrostatics_actor) {
+    boost::apply_visitor(PrepareLongRangeForce(particles),
+                         *electrostatics_actor);
+  }
+}
+
 void calc_long_range_force(ParticleRange const &particles) {
   if (electrostatics_actor) {
     boost::apply_visitor(LongRangeForce(particles), *electrostatics_actor);
@@ -27,11 +27,13 @@
 
 #include "electrostatics/debye_hueckel.hpp"
 #include "electrostatics/elc.hpp"
+#include "electrostatics/fmm.hpp"
 #include "electrostatics/icc.hpp"
 #include "electrostatics/mmm1d.hpp"
 #include "electrostatics/mmm1d_gpu.hpp"
 #include "electrostatics/p3m.hpp"
 #include "electrostatics/p3m_gpu.hpp"
+#include "electrostatics/rbe.hpp"
 #include "electrostatics/reaction_field.hpp"
 #include "electrostatics/scafacos.hpp"
 
@@ -57,6 +59,8 @@ using ElectrostaticsActor =
                    std::shared_ptr<ElectrostaticLayerCorrection>,
 #endif // P3M
                    std::shared_ptr<CoulombMMM1D>,
+                   std::shared_ptr<CoulombRBE>,
+                   std::shared_ptr<CoulombFMM>,
 #ifdef MMM1D_GPU
                    std::shared_ptr<CoulombMMM1DGpu>,
 #endif // MMM1D_GPU
@@ -111,6 +115,8 @@ template <> struct has_pressure<CoulombMMM1DGpu> : std::false_type {};
 template <> struct has_pressure<CoulombScafacos> : std::false_type {};
 #endif // SCAFACOS
 template <> struct has_pressure<CoulombMMM1D> : std::false_type {};
+template <> struct has_pressure<CoulombRBE> : std::false_type {};
+template <> struct has_pressure<CoulombFMM> : std::false_type {};
 
 } // namespace traits
 
@@ -122,13 +128,24 @@ Utils::Vector9d calc_pressure_long_range(ParticleRange const &particles);
 void sanity_checks();
 double cutoff();
 
+/** @brief Heap memory of the long-range solver, in bytes. */
+std::size_t memory_usage();
+
 void on_observable_calc();
+void on_integration_step();
 void on_coulomb_change();
 void on_boxl_change();
 void on_node_grid_change();
 void on_periodicity_change();
 void on_cell_structure_change();
 
+/**
+ * @brief Start the k-space force calculation.
+ * Methods with a mesh post the halo communication of the charge mesh here,
+ * so that it can overlap with the short-range force calculation. The forces
+ * are completed by @ref calc_long_range_force.
+ */
+void prepare_long_range_force(ParticleRange const &particles);
 void calc_long_range_force(ParticleRange const &particles);
 double calc_energy_long_range(ParticleRange const &particles);
 
@@ -66,6 +66,9 @@ struct ShortRangeForceKernel
     return {};
   }
 #endif // MMM1D_GPU
+  result_type operator()(std::shared_ptr<CoulombFMM> const &) const {
+    return {};
+  }
 #endif // ELECTROSTATICS
 };
 
@@ -168,6 +171,9 @@ struct ShortRangeEnergyKernel
     return {};
   }
 #endif // MMM1D_GPU
+  result_type operator()(std::shared_ptr<CoulombFMM> const &) const {
+    return {};
+  }
   result_type operator()(std::shared_ptr<CoulombMMM1D> const &actor) const {
     return kernel_type{[&actor](Particle const &, Particle const &, double q1q2,
                                 Utils::Vector3d const &d, double dist) {
@@ -0,0 +1,697 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config/config.hpp"
+
+#ifdef ELECTROSTATICS
+
+#include "electrostatics/fmm.hpp"
+
+#include "Particle.hpp"
+#include "ParticleRange.hpp"
+#include "cells.hpp"
+#include "communication.hpp"
+#include "event.hpp"
+#include "grid.hpp"
+
+#include <utils/Vector.hpp>
+#include <utils/math/int_pow.hpp>
+#include <utils/math/sqr.hpp>
+#include <utils/mpi/iall_gatherv.hpp>
+
+#include <boost/mpi/collectives/all_gather.hpp>
+#include <boost/mpi/collectives/all_reduce.hpp>
+#include <boost/mpi/collectives/reduce.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/request.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace {
+/** Number of values per charge in the replicated particle data. */
+auto constexpr values_per_charge = 4;
+/** Largest depth of the octree. */
+auto constexpr max_depth = 21;
+/** Largest number of charges per rank used to measure the error. */
+auto constexpr n_tuning_samples = 100;
+
+/**
+ * @brief Multi-indices @f$ \mathbf{k} = (k_x, k_y, k_z) @f$ of a Cartesian
+ * Taylor series up to a given order.
+ * The indices are sorted by increasing total order @f$ |\mathbf{k}| @f$,
+ * so that every index is preceded by all indices of lower order.
+ */
+class MultiIndices {
+  int m_order;
+  std::vector<Utils::Vector3i> m_indices;
+  std::vector<int> m_lookup;
+
+public:
+  explicit MultiIndices(int order)
+      : m_order{order}, m_lookup(Utils::int_pow<3>(order + 1), -1) {
+    for (int n = 0; n <= order; n++) {
+      for (int kx = n; kx >= 0; kx--) {
+        for (int ky = n - kx; ky >= 0; ky--) {
+          auto const kz = n - kx - ky;
+          m_lookup[(kx * (order + 1) + ky) * (order + 1) + kz] =
+              static_cast<int>(m_indices.size());
+          m_indices.emplace_back(Utils::Vector3i{{kx, ky, kz}});
+        }
+      }
+    }
+  }
+
+  auto size() const { return m_indices.size(); }
+  auto const &operator[](std::size_t i) const { return m_indices[i]; }
+  /** Position of a multi-index, or -1 for negative components. */
+  int find(Utils::Vector3i const &k) const {
+    if (k[0] < 0 or k[1] < 0 or k[2] < 0) {
+      return -1;
+    }
+    return m_lookup[(k[0] * (m_order + 1) + k[1]) * (m_order + 1) + k[2]];
+  }
+  /** Number of terms of a series up to the given order. */
+  static std::size_t n_terms(int order) {
+    return static_cast<std::size_t>((order + 1) * (order + 2) * (order + 3) /
+                                    6);
+  }
+};
+
+/** Monomials @f$ \mathbf{d}^{\mathbf{k}} @f$ for all multi-indices. */
+void calc_monomials(MultiIndices const &indices, int order,
+                    Utils::Vector3d const &d, std::vector<double> &out) {
+  std::array<std::vector<double>, 3> powers;
+  for (unsigned int i = 0; i < 3; i++) {
+    powers[i].resize(order + 1);
+    powers[i][0] = 1.;
+    for (int n = 1; n <= order; n++) {
+      powers[i][n] = powers[i][n - 1] * d[i];
+    }
+  }
+  auto const n_terms = MultiIndices::n_terms(order);
+  out.resize(n_terms);
+  for (std::size_t t = 0; t < n_terms; t++) {
+    auto const &k = indices[t];
+    out[t] = powers[0][k[0]] * powers[1][k[1]] * powers[2][k[2]];
+  }
+}
+
+/**
+ * @brief Taylor coefficients @f$ T_{\mathbf{k}}(\mathbf{r}) =
+ * \partial^{\mathbf{k}} (1/r) / \mathbf{k}! @f$ for all multi-indices
+ * up to the given order, from the recurrence relation
+ * @f$ |\mathbf{k}| r^2 T_{\mathbf{k}} + (2|\mathbf{k}| - 1)
+ * \sum_i r_i T_{\mathbf{k} - \mathbf{e}_i} + (|\mathbf{k}| - 1)
+ * \sum_i T_{\mathbf{k} - 2\mathbf{e}_i} = 0 @f$.
+ */
+void calc_taylor_coefficients(MultiIndices const &indices, int order,
+                              Utils::Vector3d const &r,
+                              std::vector<double> &out) {
+  auto const r2 = r.norm2();
+  auto const n_terms = MultiIndices::n_terms(order);
+  out.resize(n_terms);
+  out[0] = 1. / std::sqrt(r2);
+  for (std::size_t t = 1; t < n_terms; t++) {
+    auto const &k = indices[t];
+    auto const n = k[0] + k[1] + k[2];
+    auto sum = 0.;
+    for (unsigned int i = 0; i < 3; i++) {
+      auto k1 = k;
+      k1[i] -= 1;
+      if (k1[i] >= 0) {
+        sum += (2. * n - 1.) * r[i] * out[indices.find(k1)];
+        auto k2 = k1;
+        k2[i] -= 1;
+        if (k2[i] >= 0) {
+          sum += (n - 1.) * out[indices.find(k2)];
+        }
+      }
+    }
+    out[t] = -sum / (n * r2);
+  }
+}
+
+/** Cell of the octree. */
+struct Cell {
+  Utils::Vector3d center;
+  double half_width;
+  /** Largest distance of a charge from the center. */
+  double radius;
+  /** Range of the charges in the sorted charge list. */
+  int begin, end;
+  int parent;
+  std::vector<int> children;
+  /** Whether the cell contains charges of this rank. */
+  bool has_local;
+};
+
+/** Replicated charges and the octree built on top of them. */
+class Octree {
+public:
+  Octree(std::vector<double> const &charges, int local_begin, int local_end,
+         int leaf_size)
+      : m_charges{charges}, m_local_begin{local_begin},
+        m_local_end{local_end}, m_leaf_size{leaf_size} {
+    auto const n_charges =
+        static_cast<int>(charges.size()) / values_per_charge;
+    m_order.resize(n_charges);
+    std::iota(m_order.begin(), m_order.end(), 0);
+    if (n_charges == 0) {
+      return;
+    }
+    Utils::Vector3d lower = pos(0), upper = pos(0);
+    for (int i = 1; i < n_charges; i++) {
+      for (unsigned int j = 0; j < 3; j++) {
+        lower[j] = std::min(lower[j], pos(i)[j]);
+        upper[j] = std::max(upper[j], pos(i)[j]);
+      }
+    }
+    auto const extent = upper - lower;
+    auto const half_width =
+        std::max(0.5 * *std::max_element(extent.begin(), extent.end()), 1e-12);
+    m_cells.emplace_back(Cell{0.5 * (lower + upper), half_width, 0., 0,
+                              n_charges, -1, {}, false});
+    build(0, 0);
+  }
+
+  Utils::Vector3d pos(int i) const {
+    auto const *data = m_charges.data() + values_per_charge * i;
+    return {data[0], data[1], data[2]};
+  }
+  double q(int i) const { return m_charges[values_per_charge * i + 3]; }
+  bool is_local(int i) const { return i >= m_local_begin and i < m_local_end; }
+
+  auto const &cells() const { return m_cells; }
+  /** Charge in the sorted charge list. */
+  int charge(int slot) const { return m_order[slot]; }
+
+private:
+  std::vector<double> const &m_charges;
+  int m_local_begin, m_local_end, m_leaf_size;
+  std::vector<int> m_order;
+  std::vector<Cell> m_cells;
+
+  void build(int cell_id, int depth) {
+    auto const begin = m_cells[cell_id].begin;
+    auto const end = m_cells[cell_id].end;
+    auto const center = m_cells[cell_id].center;
+    auto radius2 = 0.;
+    auto has_local = false;
+    for (int slot = begin; slot < end; slot++) {
+      radius2 = std::max(radius2, (pos(m_order[slot]) - center).norm2());
+      has_local |= is_local(m_order[slot]);
+    }
+    m_cells[cell_id].radius = std::sqrt(radius2);
+    m_cells[cell_id].has_local = has_local;
+    if (end - begin <= m_leaf_size or depth == max_depth) {
+      return;
+    }
+    /* sort the charges into octants */
+    std::array<int, 9> bounds{};
+    bounds[0] = begin;
+    bounds[8] = end;
+    auto const first = m_order.begin();
+    auto const below = [this, &center](unsigned int dir) {
+      return [this, &center, dir](int i) { return pos(i)[dir] < center[dir]; };
+    };
+    bounds[4] = static_cast<int>(
+        std::partition(first + bounds[0], first + bounds[8], below(0)) - first);
+    for (int h = 0; h < 2; h++) {
+      bounds[4 * h + 2] = static_cast<int>(
+          std::partition(first + bounds[4 * h], first + bounds[4 * h + 4],
+                         below(1)) -
+          first);
+      for (int q = 0; q < 2; q++) {
+        auto const o = 4 * h + 2 * q;
+        bounds[o + 1] = static_cast<int>(
+            std::partition(first + bounds[o], first + bounds[o + 2],
+                           below(2)) -
+            first);
+      }
+    }
+    auto const child_half_width = 0.5 * m_cells[cell_id].half_width;
+    for (int octant = 0; octant < 8; octant++) {
+      if (bounds[octant] == bounds[octant + 1]) {
+        continue;
+      }
+      auto child_center = center;
+      for (unsigned int dir = 0; dir < 3; dir++) {
+        auto const upper_half = (octant >> (2 - dir)) & 1;
+        child_center[dir] += (upper_half ? 1. : -1.) * child_half_width;
+      }
+      auto const child_id = static_cast<int>(m_cells.size());
+      m_cells.emplace_back(Cell{child_center, child_half_width, 0.,
+                                bounds[octant], bounds[octant + 1], cell_id,
+                                {}, false});
+      m_cells[cell_id].children.emplace_back(child_id);
+      build(child_id, depth + 1);
+    }
+  }
+};
+
+/** Expansions of all cells and the interactions between them. */
+class Solver {
+public:
+  Solver(Octree const &tree, int order, double theta)
+      : m_tree{tree}, m_order{order}, m_theta{theta},
+        m_indices{2 * order}, m_n_terms{MultiIndices::n_terms(order)},
+        m_multipoles(tree.cells().size() * m_n_terms, 0.),
+        m_locals(tree.cells().size() * m_n_terms, 0.) {
+    for (int n = 0; n <= 2 * order; n++) {
+      m_binomials.emplace_back(n + 1, 1.);
+      for (int k = 1; k < n; k++) {
+        m_binomials[n][k] = m_binomials[n - 1][k - 1] + m_binomials[n - 1][k];
+      }
+    }
+  }
+
+  /**
+   * @brief Calculate the potential and its gradient at the local charges.
+   * @return Potential and gradient for each local charge, indexed by the
+   * position of the charge in the local range.
+   */
+  auto run(int n_local, int local_begin) {
+    std::vector<double> potentials(n_local, 0.);
+    std::vector<Utils::Vector3d> gradients(n_local, Utils::Vector3d{});
+    if (m_tree.cells().empty()) {
+      return std::make_pair(potentials, gradients);
+    }
+    upward_pass();
+    interact(0, 0, potentials, gradients, local_begin);
+    downward_pass(potentials, gradients, local_begin);
+    return std::make_pair(potentials, gradients);
+  }
+
+private:
+  Octree const &m_tree;
+  int m_order;
+  double m_theta;
+  MultiIndices m_indices;
+  std::size_t m_n_terms;
+  std::vector<double> m_multipoles;
+  std::vector<double> m_locals;
+  std::vector<std::vector<double>> m_binomials;
+  std::vector<double> m_buffer;
+
+  double *multipole(int cell_id) {
+    return m_multipoles.data() + cell_id * m_n_terms;
+  }
+  double *local(int cell_id) { return m_locals.data() + cell_id * m_n_terms; }
+
+  /** Product of binomial coefficients @f$ \binom{\mathbf{n}}{\mathbf{k}}
+   *  @f$ of two multi-indices. */
+  double binomial(Utils::Vector3i const &n, Utils::Vector3i const &k) const {
+    return m_binomials[n[0]][k[0]] * m_binomials[n[1]][k[1]] *
+           m_binomials[n[2]][k[2]];
+  }
+
+  /** P2M and M2M, children are stored after their parents. */
+  void upward_pass() {
+    auto const &cells = m_tree.cells();
+    for (auto cell_id = static_cast<int>(cells.size()) - 1; cell_id >= 0;
+         cell_id--) {
+      auto const &cell = cells[cell_id];
+      auto *m = multipole(cell_id);
+      if (cell.children.empty()) {
+        for (int slot = cell.begin; slot < cell.end; slot++) {
+          auto const i = m_tree.charge(slot);
+          calc_monomials(m_indices, m_order, m_tree.pos(i) - cell.center,
+                         m_buffer);
+          for (std::size_t t = 0; t < m_n_terms; t++) {
+            m[t] += m_tree.q(i) * m_buffer[t];
+          }
+        }
+        continue;
+      }
+      for (auto const child_id : cell.children) {
+        auto const *m_child = multipole(child_id);
+        calc_monomials(m_indices, m_order, cells[child_id].center - cell.center,
+                       m_buffer);
+        for (std::size_t t = 0; t < m_n_terms; t++) {
+          auto const &k = m_indices[t];
+          for (std::size_t s = 0; s <= t; s++) {
+            auto const &j = m_indices[s];
+            if (j[0] <= k[0] and j[1] <= k[1] and j[2] <= k[2]) {
+              m[t] += binomial(k, j) * m_child[s] *
+                      m_buffer[m_indices.find(k - j)];
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /** M2L: local expansion of the field of a source cell around the center
+   *  of a target cell. */
+  void multipole_to_local(int target_id, int source_id) {
+    auto const &cells = m_tree.cells();
+    calc_taylor_coefficients(
+        m_indices, 2 * m_order,
+        cells[target_id].center - cells[source_id].center, m_buffer);
+    auto const *m = multipole(source_id);
+    auto *l = local(target_id);
+    for (std::size_t t = 0; t < m_n_terms; t++) {
+      auto const &n = m_indices[t];
+      auto sum = 0.;
+      for (std::size_t s = 0; s < m_n_terms; s++) {
+        auto const &k = m_indices[s];
+        auto const sign = ((k[0] + k[1] + k[2]) % 2 == 0) ? 1. : -1.;
+        sum += sign * m[s] * binomial(n + k, k) *
+               m_buffer[m_indices.find(n + k)];
+      }
+      l[t] += sum;
+    }
+  }
+
+  /** P2P: direct interaction of the local charges of a target cell with
+   *  the charges of a source cell. */
+  void particle_to_particle(int target_id, int source_id,
+                            std::vector<double> &potentials,
+                            std::vector<Utils::Vector3d> &gradients,
+                            int local_begin) const {
+    auto const &target = m_tree.cells()[target_id];
+    auto const &source = m_tree.cells()[source_id];
+    for (int slot_i = target.begin; slot_i < target.end; slot_i++) {
+      auto const i = m_tree.charge(slot_i);
+      if (not m_tree.is_local(i)) {
+        continue;
+      }
+      auto const pos_i = m_tree.pos(i);
+      auto potential = 0.;
+      Utils::Vector3d gradient{};
+      for (int slot_j = source.begin; slot_j < source.end; slot_j++) {
+        auto const j = m_tree.charge(slot_j);
+        if (i == j) {
+          continue;
+        }
+        auto const d = pos_i - m_tree.pos(j);
+        auto const dist_inv = 1. / d.norm();
+        auto const q_dist_inv = m_tree.q(j) * dist_inv;
+        potential += q_dist_inv;
+        gradient -= (q_dist_inv * Utils::sqr(dist_inv)) * d;
+      }
+      potentials[i - local_begin] += potential;
+      gradients[i - local_begin] += gradient;
+    }
+  }
+
+  /** Dual tree traversal. */
+  void interact(int target_id, int source_id, std::vector<double> &potentials,
+                std::vector<Utils::Vector3d> &gradients, int local_begin) {
+    auto const &cells = m_tree.cells();
+    auto const &target = cells[target_id];
+    auto const &source = cells[source_id];
+    if (not target.has_local) {
+      return;
+    }
+    if (target_id != source_id) {
+      auto const dist = (target.center - source.center).norm();
+      if (target.radius + source.radius < m_theta * dist) {
+        multipole_to_local(target_id, source_id);
+        return;
+      }
+    }
+    auto const target_is_leaf = target.children.empty();
+    auto const source_is_leaf = source.children.empty();
+    if (target_is_leaf and source_is_leaf) {
+      particle_to_particle(target_id, source_id, potentials, gradients,
+                           local_begin);
+    } else if (target_id == source_id) {
+      for (auto const a : target.children) {
+        for (auto const b : target.children) {
+          interact(a, b, potentials, gradients, local_begin);
+        }
+      }
+    } else if (source_is_leaf or
+               (not target_is_leaf and target.radius >= source.radius)) {
+      for (auto const a : target.children) {
+        interact(a, source_id, potentials, gradients, local_begin);
+      }
+    } else {
+      for (auto const b : source.children) {
+        interact(target_id, b, potentials, gradients, local_begin);
+      }
+    }
+  }
+
+  /** L2L and L2P, parents are stored before their children. */
+  void downward_pass(std::vector<double> &potentials,
+                     std::vector<Utils::Vector3d> &gradients,
+                     int local_begin) {
+    auto const &cells = m_tree.cells();
+    for (int cell_id = 0; cell_id < static_cast<int>(cells.size());
+         cell_id++) {
+      auto const &cell = cells[cell_id];
+      if (not cell.has_local) {
+        continue;
+      }
+      auto *l = local(cell_id);
+      if (cell.parent != -1) {
+        auto const *l_parent = local(cell.parent);
+        calc_monomials(m_indices, m_order,
+                       cell.center - cells[cell.parent].center, m_buffer);
+        for (std::size_t t = 0; t < m_n_terms; t++) {
+          auto const &n = m_indices[t];
+          for (std::size_t s = t; s < m_n_terms; s++) {
+            auto const &j = m_indices[s];
+            if (j[0] >= n[0] and j[1] >= n[1] and j[2] >= n[2]) {
+              l[t] += l_parent[s] * binomial(j, n) *
+                      m_buffer[m_indices.find(j - n)];
+            }
+          }
+        }
+      }
+      if (not cell.children.empty()) {
+        continue;
+      }
+      for (int slot = cell.begin; slot < cell.end; slot++) {
+        auto const i = m_tree.charge(slot);
+        if (not m_tree.is_local(i)) {
+          continue;
+        }
+        calc_monomials(m_indices, m_order, m_tree.pos(i) - cell.center,
+                       m_buffer);
+        auto potential = 0.;
+        Utils::Vector3d gradient{};
+        for (std::size_t t = 0; t < m_n_terms; t++) {
+          auto const &n = m_indices[t];
+          potential += l[t] * m_buffer[t];
+          for (unsigned int dir = 0; dir < 3; dir++) {
+            if (n[dir] > 0) {
+              auto n1 = n;
+              n1[dir] -= 1;
+              gradient[dir] += n[dir] * l[t] * m_buffer[m_indices.find(n1)];
+            }
+          }
+        }
+        potentials[i - local_begin] += potential;
+        gradients[i - local_begin] += gradient;
+      }
+    }
+  }
+};
+
+/**
+ * @brief Replicate the positions and charges of all charged particles.
+ * @return Local charged particles, all charges and the offset of the
+ * local charges.
+ */
+auto gather_charges(ParticleRange const &particles) {
+  auto const &comm = ::comm_cart;
+  std::vector<Particle *> local_particles;
+  std::vector<double> local_charges;
+  std::vector<double> all_charges;
+
+  for (auto &p : particles) {
+    if (p.q() != 0.) {
+      local_particles.emplace_back(&p);
+      local_charges.insert(local_charges.end(),
+                           {p.pos()[0], p.pos()[1], p.pos()[2], p.q()});
+    }
+  }
+
+  auto const local_size = static_cast<int>(local_charges.size());
+  std::vector<int> all_sizes;
+  boost::mpi::all_gather(comm, local_size, all_sizes);
+
+  auto const offset =
+      std::accumulate(all_sizes.begin(), all_sizes.begin() + comm.rank(), 0);
+  auto const total_size =
+      std::accumulate(all_sizes.begin() + comm.rank(), all_sizes.end(), offset);
+
+  if (comm.size() > 1) {
+    all_charges.resize(total_size);
+    auto reqs = Utils::Mpi::iall_gatherv(comm, local_charges.data(), local_size,
+                                         all_charges.data(), all_sizes.data());
+    boost::mpi::wait_all(reqs.begin(), reqs.end());
+  } else {
+    std::swap(all_charges, local_charges);
+  }
+
+  return std::make_tuple(std::move(local_particles), std::move(all_charges),
+                         offset / values_per_charge);
+}
+
+/** Gradient of the potential at one charge, by direct summation. */
+Utils::Vector3d direct_sum_gradient(std::vector<double> const &all_charges,
+                                    int i) {
+  auto const n_charges =
+      static_cast<int>(all_charges.size()) / values_per_charge;
+  auto const pos = [&all_charges](int j) {
+    auto const *data = all_charges.data() + values_per_charge * j;
+    return Utils::Vector3d{data[0], data[1], data[2]};
+  };
+  Utils::Vector3d gradient{};
+  for (int j = 0; j < n_charges; j++) {
+    if (j != i) {
+      auto const d = pos(i) - pos(j);
+      auto const q_j = all_charges[values_per_charge * j + 3];
+      gradient -= (q_j / Utils::int_pow<3>(d.norm())) * d;
+    }
+  }
+  return gradient;
+}
+
+/** Potential and its gradient at the local charges. */
+auto calc_fields(std::vector<double> const &all_charges, int local_begin,
+                 int n_local, int order, double theta, int leaf_size) {
+  Octree const tree(all_charges, local_begin, local_begin + n_local,
+                    leaf_size);
+  Solver solver(tree, order, theta);
+  return solver.run(n_local, local_begin);
+}
+} // namespace
+
+CoulombFMM::CoulombFMM(double prefactor, double accuracy, int order,
+                       double theta, int leaf_size)
+    : accuracy{accuracy}, order{order}, theta{theta}, leaf_size{leaf_size},
+      m_is_tuned{order != -1} {
+  set_prefactor(prefactor);
+  if (accuracy <= 0.) {
+    throw std::domain_error("Parameter 'accuracy' must be > 0");
+  }
+  if ((order < 1 or order > max_order) and order != -1) {
+    throw std::domain_error("Parameter 'order' must be >= 1 and <= " +
+                            std::to_string(max_order));
+  }
+  if (theta <= 0. or theta >= 1.) {
+    throw std::domain_error("Parameter 'theta' must be > 0 and < 1");
+  }
+  if (leaf_size <= 0) {
+    throw std::domain_error("Parameter 'leaf_size' must be > 0");
+  }
+}
+
+void CoulombFMM::sanity_checks_periodicity() const {
+  if (box_geo.periodic(0) || box_geo.periodic(1) || box_geo.periodic(2)) {
+    throw std::runtime_error(
+        "CoulombFMM: requires periodicity (False, False, False)");
+  }
+}
+
+void CoulombFMM::add_long_range_forces(ParticleRange const &particles) const {
+  auto const [local_particles, all_charges, local_begin] =
+      gather_charges(particles);
+  auto const n_local = static_cast<int>(local_particles.size());
+  auto const fields = calc_fields(all_charges, local_begin, n_local, order,
+                                  theta, leaf_size);
+  auto const &gradients = fields.second;
+  for (int i = 0; i < n_local; i++) {
+    auto &p = *local_particles[i];
+    p.force() -= (prefactor * p.q()) * gradients[i];
+  }
+}
+
+double CoulombFMM::long_range_energy(ParticleRange const &particles) const {
+  auto const [local_particles, all_charges, local_begin] =
+      gather_charges(particles);
+  auto const n_local = static_cast<int>(local_particles.size());
+  auto const fields = calc_fields(all_charges, local_begin, n_local, order,
+                                  theta, leaf_size);
+  auto const &potentials = fields.first;
+  auto local_energy = 0.;
+  for (int i = 0; i < n_local; i++) {
+    local_energy += 0.5 * local_particles[i]->q() * potentials[i];
+  }
+  auto energy = 0.;
+  boost::mpi::reduce(comm_cart, local_energy, energy, std::plus<>(), 0);
+  return prefactor * energy;
+}
+
+void CoulombFMM::tune() {
+  if (is_tuned()) {
+    return;
+  }
+  auto const particles = cell_structure.local_particles();
+  auto const [local_particles, all_charges, local_begin] =
+      gather_charges(particles);
+  auto const n_local = static_cast<int>(local_particles.size());
+
+  /* reference forces of a sample of the local charges */
+  auto const stride = std::max(1, n_local / n_tuning_samples);
+  std::vector<int> samples;
+  std::vector<Utils::Vector3d> reference;
+  for (int i = 0; i < n_local; i += stride) {
+    samples.emplace_back(i);
+    reference.emplace_back(local_particles[i]->q() *
+                           direct_sum_gradient(all_charges, local_begin + i));
+  }
+  auto local_norm = 0.;
+  for (auto const &force : reference) {
+    local_norm += force.norm2();
+  }
+  auto const norm =
+      boost::mpi::all_reduce(comm_cart, local_norm, std::plus<>());
+
+  for (order = 1; order <= max_order; order++) {
+    auto const fields = calc_fields(all_charges, local_begin, n_local, order,
+                                    theta, leaf_size);
+    auto local_error = 0.;
+    for (std::size_t s = 0; s < samples.size(); s++) {
+      auto const i = samples[s];
+      auto const force = local_particles[i]->q() * fields.second[i];
+      local_error += (force - reference[s]).norm2();
+    }
+    auto const error =
+        boost::mpi::all_reduce(comm_cart, local_error, std::plus<>());
+    if (error <= Utils::sqr(accuracy) * norm) {
+      break;
+    }
+  }
+  if (order > max_order) {
+    order = -1;
+    throw std::runtime_error(
+        "CoulombFMM: failed to reach requested accuracy with order " +
+        std::to_string(max_order));
+  }
+  m_is_tuned = true;
+  on_coulomb_change();
+}
+
+#endif // ELECTROSTATICS
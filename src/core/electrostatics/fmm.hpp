@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Fast multipole method (FMM) for Coulomb interactions with open boundary
+ *  conditions.
+ *
+ *  The charges are sorted into an adaptive octree. Multipole and local
+ *  expansions are Cartesian Taylor series of arbitrary order, whose
+ *  coefficients are obtained from the recurrence relation of the
+ *  derivatives of @f$ 1/r @f$ @cite lindsay01a. Cell pairs are processed
+ *  by a dual tree traversal with a multipole acceptance criterion
+ *  @cite dehnen02a.
+ *
+ *  The charges of all MPI ranks are replicated on every rank, which builds
+ *  the complete tree and its multipole expansions. The expensive part of the
+ *  algorithm, the cell-cell and particle-particle interactions, is only
+ *  evaluated for the target cells that contain local particles.
+ *
+ *  Implementation in fmm.cpp.
+ */
+
+#ifndef ESPRESSO_SRC_CORE_ELECTROSTATICS_FMM_HPP
+#define ESPRESSO_SRC_CORE_ELECTROSTATICS_FMM_HPP
+
+#include "config/config.hpp"
+
+#ifdef ELECTROSTATICS
+
+#include "electrostatics/actor.hpp"
+
+#include "ParticleRange.hpp"
+
+#include <utils/Vector.hpp>
+
+/** @brief Fast multipole method solver for open boundaries. */
+struct CoulombFMM : public Coulomb::Actor<CoulombFMM> {
+  /** Requested relative RMS force error, used to tune the order. */
+  double accuracy;
+  /** Order of the multipole and local expansions. */
+  int order;
+  /** Opening angle of the multipole acceptance criterion. */
+  double theta;
+  /** Largest number of charges in a leaf cell of the octree. */
+  int leaf_size;
+
+  /** Largest supported expansion order. */
+  static constexpr int max_order = 12;
+
+  CoulombFMM(double prefactor, double accuracy, int order, double theta,
+             int leaf_size);
+
+  /**
+   * @brief Choose the smallest expansion order that reaches the requested
+   * accuracy.
+   * The FMM forces are compared with a direct summation for a sample of
+   * the charges. The order is only tuned if it was not set by the user.
+   */
+  void tune();
+  bool is_tuned() const { return m_is_tuned; }
+
+  void on_activation() {
+    sanity_checks();
+    tune();
+  }
+  void on_boxl_change() const {}
+  void on_node_grid_change() const {}
+  void on_periodicity_change() const { sanity_checks_periodicity(); }
+  void on_cell_structure_change() const {}
+  void init() const {}
+
+  void sanity_checks() const {
+    sanity_checks_periodicity();
+    sanity_checks_charge_neutrality();
+  }
+
+  /** Add the forces of all pairs of charges. */
+  void add_long_range_forces(ParticleRange const &particles) const;
+
+  /** Compute the energy of all pairs of charges. */
+  double long_range_energy(ParticleRange const &particles) const;
+
+private:
+  bool m_is_tuned;
+
+  void sanity_checks_periodicity() const;
+};
+
+#endif // ELECTROSTATICS
+#endif
@@ -261,6 +261,9 @@ struct SanityChecksICC : public boost::static_visitor<void> {
   [[noreturn]] void operator()(std::shared_ptr<ReactionField> const &) const {
     throw std::runtime_error("ICC does not work with ReactionField.");
   }
+  [[noreturn]] void operator()(std::shared_ptr<CoulombRBE> const &) const {
+    throw std::runtime_error("ICC does not work with CoulombRBE.");
+  }
 };
 
 void ICCStar::sanity_check() const {
@@ -254,7 +254,9 @@ void CoulombP3M::init() {
 
   int ca_mesh_size =
       fft_init(p3m.local_mesh.dim, p3m.local_mesh.margin, p3m.params.mesh,
-               p3m.params.mesh_off, p3m.ks_pnum, p3m.fft, node_grid, comm_cart);
+               p3m.params.mesh_off, p3m.ks_pnum, p3m.fft, node_grid, comm_cart,
+               p3m.params.tuning, p3m.params.kspace_ranks,
+               p3m.params.fft_decomposition);
   p3m.rs_mesh.resize(ca_mesh_size);
 
   for (auto &e : p3m.E_mesh) {
@@ -271,14 +273,25 @@ void CoulombP3M::init() {
 
 CoulombP3M::CoulombP3M(P3MParameters &&parameters, double prefactor,
                        int tune_timings, bool tune_verbose,
-                       bool check_complex_residuals)
+                       bool check_complex_residuals,
+                       std::string fftw_wisdom_file, int retune_interval,
+                       double retune_tolerance)
     : p3m{std::move(parameters)}, tune_timings{tune_timings},
-      tune_verbose{tune_verbose}, check_complex_residuals{
-                                      check_complex_residuals} {
+      tune_verbose{tune_verbose},
+      check_complex_residuals{check_complex_residuals},
+      fftw_wisdom_file{std::move(fftw_wisdom_file)},
+      retune_interval{retune_interval}, retune_tolerance{retune_tolerance},
+      m_target_accuracy{p3m.params.accuracy} {
 
   if (tune_timings <= 0) {
     throw std::domain_error("Parameter 'timings' must be > 0");
   }
+  if (retune_interval < 0) {
+    throw std::domain_error("Parameter 'retune_interval' must be >= 0");
+  }
+  if (retune_tolerance <= 1.) {
+    throw std::domain_error("Parameter 'retune_tolerance' must be > 1");
+  }
   m_is_tuned = !p3m.params.tuning;
   p3m.params.tuning = false;
   set_prefactor(prefactor);
@@ -448,11 +461,25 @@ Utils::Vector9d CoulombP3M::p3m_calc_kspace_pressure_tensor() {
   return node_k_space_pressure_tensor * prefactor / (2. * box_geo.volume());
 }
 
+void CoulombP3M::prepare_long_range_forces(ParticleRange const &particles) {
+  charge_assign(particles);
+  auto rs_mesh = p3m.rs_mesh.data();
+  p3m.sm.gather_grid_begin(Utils::make_span(&rs_mesh, 1), comm_cart,
+                           p3m.local_mesh.dim);
+}
+
 double CoulombP3M::long_range_kernel(bool force_flag, bool energy_flag,
                                      ParticleRange const &particles) {
   /* Gather information for FFT grid inside the nodes domain (inner local mesh)
-   * and perform forward 3D FFT (Charge Assignment Mesh). */
-  p3m.sm.gather_grid(p3m.rs_mesh.data(), comm_cart, p3m.local_mesh.dim);
+   * and perform forward 3D FFT (Charge Assignment Mesh). The halo summation
+   * may have been started in prepare_long_range_forces(). */
+  auto rs_mesh = p3m.rs_mesh.data();
+  if (not p3m.sm.gather_pending()) {
+    p3m.sm.gather_grid_begin(Utils::make_span(&rs_mesh, 1), comm_cart,
+                             p3m.local_mesh.dim);
+  }
+  p3m.sm.gather_grid_finish(Utils::make_span(&rs_mesh, 1), comm_cart,
+                            p3m.local_mesh.dim);
   fft_perform_forw(p3m.rs_mesh.data(), p3m.fft, comm_cart);
 
   // Note: after these calls, the grids are in the order yzx and not xyz
@@ -497,13 +524,12 @@ double CoulombP3M::long_range_kernel(bool force_flag, bool energy_flag,
 
     /* Back FFT force component mesh */
     auto const check_complex = !p3m.params.tuning and check_complex_residuals;
-    for (int d = 0; d < 3; d++) {
-      fft_perform_back(p3m.E_mesh[d].data(), check_complex, p3m.fft, comm_cart);
-    }
-
-    /* redistribute force component mesh */
     std::array<double *, 3> E_fields = {
         {p3m.E_mesh[0].data(), p3m.E_mesh[1].data(), p3m.E_mesh[2].data()}};
+    fft_perform_back(Utils::make_span(E_fields), check_complex, p3m.fft,
+                     comm_cart);
+
+    /* redistribute force component mesh */
     p3m.sm.spread_grid(Utils::make_span(E_fields), comm_cart,
                        p3m.local_mesh.dim);
 
@@ -623,6 +649,24 @@ public:
     return {Utils::Vector2d{rs_err, ks_err}.norm(), rs_err, ks_err, alpha_L};
   }
 
+  std::tuple<double, double, double>
+  calculate_error(Utils::Vector3i const &mesh, int cao, double r_cut_iL,
+                  double alpha_L) const override {
+    auto const rs_err = p3m_real_space_error(
+        m_prefactor, r_cut_iL, p3m.sum_qpart, p3m.sum_q2, alpha_L);
+#ifdef CUDA
+    if (has_actor_of_type<CoulombP3MGPU>(electrostatics_actor)) {
+      auto const ks_err = p3mgpu_k_space_error(m_prefactor, mesh, cao,
+                                               p3m.sum_qpart, p3m.sum_q2,
+                                               alpha_L);
+      return {Utils::Vector2d{rs_err, ks_err}.norm(), rs_err, ks_err};
+    }
+#endif
+    auto const ks_err = p3m_k_space_error(m_prefactor, mesh, cao, p3m.sum_qpart,
+                                          p3m.sum_q2, alpha_L);
+    return {Utils::Vector2d{rs_err, ks_err}.norm(), rs_err, ks_err};
+  }
+
   void determine_mesh_limits() override {
     auto const mesh_density =
         static_cast<double>(p3m.params.mesh[0]) * box_geo.length_inv()[0];
@@ -708,6 +752,9 @@ void CoulombP3M::tune() {
   if (p3m.params.r_cut_iL == 0. and p3m.params.r_cut != 0.) {
     p3m.params.r_cut_iL = p3m.params.r_cut * box_geo.length_inv()[0];
   }
+  if (not fftw_wisdom_file.empty()) {
+    fft_import_wisdom(fftw_wisdom_file, comm_cart);
+  }
   if (not is_tuned()) {
     count_charged_particles();
     if (p3m.sum_qpart == 0) {
@@ -731,6 +778,26 @@ void CoulombP3M::tune() {
     }
   }
   init();
+  if (not fftw_wisdom_file.empty()) {
+    fft_export_wisdom(fftw_wisdom_file, comm_cart);
+  }
+}
+
+void CoulombP3M::on_integration_step() {
+  if (retune_interval == 0 or p3m.params.tuning or
+      ++m_steps_since_check < retune_interval) {
+    return;
+  }
+  m_steps_since_check = 0;
+  count_charged_particles();
+  if (p3m.sum_qpart == 0) {
+    return;
+  }
+  CoulombTuningAlgorithm parameters(p3m, prefactor, tune_timings);
+  parameters.setup_logger(false);
+  if (parameters.adapt(m_target_accuracy, retune_tolerance)) {
+    on_coulomb_change();
+  }
 }
 
 void CoulombP3M::sanity_checks_boxl() const {
@@ -789,6 +856,11 @@ void CoulombP3M::sanity_checks_node_grid() const {
     throw std::runtime_error(
         "CoulombP3M: node grid must be sorted, largest first");
   }
+  if (p3m.params.kspace_ranks > 0 and
+      n_nodes % p3m.params.kspace_ranks != 0) {
+    throw std::runtime_error("CoulombP3M: parameter 'kspace_ranks' must be "
+                             "a divisor of the number of MPI ranks");
+  }
 }
 
 void CoulombP3M::scaleby_box_l() {
@@ -48,6 +48,7 @@
 #include "p3m/send_mesh.hpp"
 
 #include "ParticleRange.hpp"
+#include "memory_usage.hpp"
 
 #include <utils/Vector.hpp>
 #include <utils/constants.hpp>
@@ -55,6 +56,8 @@
 
 #include <array>
 #include <cmath>
+#include <cstddef>
+#include <string>
 
 struct p3m_data_struct : public p3m_data_struct_base {
   explicit p3m_data_struct(P3MParameters &&parameters)
@@ -80,6 +83,16 @@ struct p3m_data_struct : public p3m_data_struct_base {
   p3m_send_mesh sm;
 
   fft_data_struct fft;
+
+  /** Heap memory of the meshes and of the communication buffers, in bytes. */
+  std::size_t memory_usage() const {
+    return p3m_data_struct_base::memory_usage() +
+           MemoryUsage::heap_size(rs_mesh) +
+           MemoryUsage::heap_size(E_mesh[0]) +
+           MemoryUsage::heap_size(E_mesh[1]) +
+           MemoryUsage::heap_size(E_mesh[2]) + inter_weights.memory_usage() +
+           sm.memory_usage() + fft.memory_usage();
+  }
 };
 
 /** @brief P3M solver. */
@@ -90,16 +103,43 @@ struct CoulombP3M : public Coulomb::Actor<CoulombP3M> {
   int tune_timings;
   bool tune_verbose;
   bool check_complex_residuals;
+  /** File to read FFTW wisdom from and write it to; empty to disable. */
+  std::string fftw_wisdom_file;
+  /** Number of integration steps between two accuracy checks; 0 to
+   *  disable the accuracy monitoring. */
+  int retune_interval;
+  /** Tolerated ratio between the error estimate and the target accuracy. */
+  double retune_tolerance;
 
 private:
   bool m_is_tuned;
+  /** Target accuracy of the accuracy monitoring. */
+  double m_target_accuracy;
+  /** Number of integration steps since the last accuracy check. */
+  int m_steps_since_check = 0;
 
 public:
   CoulombP3M(P3MParameters &&parameters, double prefactor, int tune_timings,
-             bool tune_verbose, bool check_complex_residuals);
+             bool tune_verbose, bool check_complex_residuals,
+             std::string fftw_wisdom_file, int retune_interval,
+             double retune_tolerance);
 
   bool is_tuned() const { return m_is_tuned; }
 
+  /**
+   * @brief Monitor the accuracy during an integration.
+   *
+   * Every @ref retune_interval integration steps, the error estimate is
+   * re-evaluated with the current charges and box. When it drifted away
+   * from the target accuracy by more than @ref retune_tolerance, e.g.
+   * after a volume change or a change of the charges, the
+   * @ref P3MParameters::alpha "alpha",
+   * @ref P3MParameters::r_cut "r_cut" and, if needed, the
+   * @ref P3MParameters::mesh "mesh" are adapted without timings
+   * (see @ref TuningAlgorithm::adapt).
+   */
+  void on_integration_step();
+
   /** Compute the k-space part of forces and energies. */
   double kernel(bool force_flag, bool energy_flag,
                 ParticleRange const &particles);
@@ -230,6 +270,16 @@ public:
     long_range_kernel(true, false, particles);
   }
 
+  /**
+   * @brief Assign the charges and start the halo summation of the charge
+   * mesh, which then proceeds while the caller runs the short-range loop.
+   * The k-space calculation is completed by the next kernel call.
+   */
+  void prepare_long_range_forces(ParticleRange const &particles);
+
+  /** Whether @ref prepare_long_range_forces was called without a kernel. */
+  bool is_prepared() const { return p3m.sm.gather_pending(); }
+
   /** Compute the k-space part of forces and energies. */
   double long_range_kernel(bool force_flag, bool energy_flag,
                            ParticleRange const &particles);
@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config/config.hpp"
+
+#ifdef ELECTROSTATICS
+
+#include "electrostatics/rbe.hpp"
+
+#include "Particle.hpp"
+#include "ParticleRange.hpp"
+#include "communication.hpp"
+#include "grid.hpp"
+#include "random.hpp"
+
+#include <utils/Vector.hpp>
+#include <utils/constants.hpp>
+#include <utils/math/sqr.hpp>
+
+#include <boost/mpi/collectives/all_reduce.hpp>
+#include <boost/mpi/collectives/reduce.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+/** Smallest Gaussian factor of a wave vector taken into account. */
+static auto constexpr weight_cutoff = 1e-16;
+
+CoulombRBE::CoulombRBE(double prefactor, double alpha, double r_cut,
+                       int batch_size, int seed)
+    : alpha{alpha}, r_cut{r_cut}, batch_size{batch_size},
+      seed{static_cast<std::uint32_t>(seed)}, rng_counter{0u} {
+  set_prefactor(prefactor);
+  if (alpha <= 0.) {
+    throw std::domain_error("Parameter 'alpha' must be > 0");
+  }
+  if (r_cut <= 0.) {
+    throw std::domain_error("Parameter 'r_cut' must be > 0");
+  }
+  if (batch_size <= 0) {
+    throw std::domain_error("Parameter 'batch_size' must be > 0");
+  }
+  if (seed < 0) {
+    throw std::domain_error("Parameter 'seed' must be >= 0");
+  }
+}
+
+void CoulombRBE::sanity_checks_periodicity() const {
+  if (!box_geo.periodic(0) || !box_geo.periodic(1) || !box_geo.periodic(2)) {
+    throw std::runtime_error(
+        "CoulombRBE: requires periodicity (True, True, True)");
+  }
+}
+
+/** Largest wave vector index with a Gaussian factor above the cutoff. */
+static int wave_vector_index_max(double alpha, double box_l) {
+  auto const m_max = std::sqrt(-std::log(weight_cutoff)) * alpha * box_l /
+                     Utils::pi();
+  return static_cast<int>(std::ceil(m_max));
+}
+
+void CoulombRBE::init() {
+  /* The Gaussian factor of the Ewald sum factorizes in the three Cartesian
+   * directions, hence the components of the wave vectors are drawn from
+   * independent discrete distributions. The zero wave vector is rejected,
+   * which renormalizes the product distribution by its sum minus one. */
+  m_sampling_norm = 1.;
+  for (unsigned int i = 0; i < 3; i++) {
+    auto const m_max = wave_vector_index_max(alpha, box_geo.length()[i]);
+    auto const pref = Utils::pi() / (alpha * box_geo.length()[i]);
+    auto &cdf = m_cdf[i];
+    cdf.resize(2 * m_max + 1);
+    auto sum = 0.;
+    for (int m = -m_max; m <= m_max; m++) {
+      sum += std::exp(-Utils::sqr(pref * m));
+      cdf[m + m_max] = sum;
+    }
+    for (auto &value : cdf) {
+      value /= sum;
+    }
+    m_sampling_norm *= sum;
+  }
+  m_sampling_norm -= 1.;
+}
+
+std::vector<Utils::Vector3d> CoulombRBE::sample_wave_vectors() const {
+  std::vector<Utils::Vector3d> wave_vectors(batch_size);
+  for (int l = 0; l < batch_size; l++) {
+    Utils::Vector3i m{};
+    for (int attempt = 0; m == Utils::Vector3i{}; attempt++) {
+      auto const noise = Random::noise_uniform<RNGSalt::RANDOM_BATCH_EWALD>(
+          rng_counter.value(), seed, l, attempt);
+      for (unsigned int i = 0; i < 3; i++) {
+        auto const &cdf = m_cdf[i];
+        auto const u = noise[i] + 0.5;
+        auto const it = std::upper_bound(cdf.begin(), cdf.end(), u);
+        auto const index = std::min(static_cast<std::size_t>(it - cdf.begin()),
+                                    cdf.size() - 1u);
+        m[i] = static_cast<int>(index) - static_cast<int>(cdf.size() / 2u);
+      }
+    }
+    wave_vectors[l] = 2. * Utils::pi() *
+                      Utils::hadamard_product(m, box_geo.length_inv());
+  }
+  return wave_vectors;
+}
+
+void CoulombRBE::add_long_range_forces(ParticleRange const &particles) {
+  auto const wave_vectors = sample_wave_vectors();
+  rng_counter.increment();
+
+  /* structure factors of the batch, real and imaginary parts interleaved */
+  std::vector<double> local_structure_factors(2 * batch_size, 0.);
+  for (auto const &p : particles) {
+    if (p.q() != 0.) {
+      for (int l = 0; l < batch_size; l++) {
+        auto const phase = wave_vectors[l] * p.pos();
+        local_structure_factors[2 * l] += p.q() * std::cos(phase);
+        local_structure_factors[2 * l + 1] += p.q() * std::sin(phase);
+      }
+    }
+  }
+  std::vector<double> structure_factors(2 * batch_size);
+  boost::mpi::all_reduce(comm_cart, local_structure_factors.data(),
+                         2 * batch_size, structure_factors.data(),
+                         std::plus<double>());
+
+  auto const volume = box_geo.volume();
+  auto const pref = prefactor * 4. * Utils::pi() / volume * m_sampling_norm /
+                    static_cast<double>(batch_size);
+  for (auto &p : particles) {
+    if (p.q() != 0.) {
+      Utils::Vector3d force{};
+      for (int l = 0; l < batch_size; l++) {
+        auto const &k = wave_vectors[l];
+        auto const phase = k * p.pos();
+        auto const im = std::sin(phase) * structure_factors[2 * l] -
+                        std::cos(phase) * structure_factors[2 * l + 1];
+        force += (im / k.norm2()) * k;
+      }
+      p.force() += (pref * p.q()) * force;
+    }
+  }
+}
+
+double CoulombRBE::long_range_energy(ParticleRange const &particles) {
+  /* The k-space sum runs over one half of the wave vectors, since the terms
+   * of k and -k are identical. */
+  Utils::Vector3i m_max{};
+  Utils::Vector3d pref{};
+  for (unsigned int i = 0; i < 3; i++) {
+    m_max[i] = wave_vector_index_max(alpha, box_geo.length()[i]);
+    pref[i] = Utils::pi() / (alpha * box_geo.length()[i]);
+  }
+  auto const exponent_max = -std::log(weight_cutoff);
+  auto const volume = box_geo.volume();
+
+  auto node_energy = 0.;
+  auto local_q2 = 0.;
+  auto local_q = 0.;
+  for (auto const &p : particles) {
+    local_q2 += Utils::sqr(p.q());
+    local_q += p.q();
+  }
+  std::vector<double> weights;
+  std::vector<Utils::Vector3d> wave_vectors;
+  for (int mx = 0; mx <= m_max[0]; mx++) {
+    for (int my = (mx == 0) ? 0 : -m_max[1]; my <= m_max[1]; my++) {
+      for (int mz = (mx == 0 and my == 0) ? 1 : -m_max[2]; mz <= m_max[2];
+           mz++) {
+        auto const exponent = Utils::sqr(pref[0] * mx) +
+                              Utils::sqr(pref[1] * my) +
+                              Utils::sqr(pref[2] * mz);
+        if (exponent > exponent_max) {
+          continue;
+        }
+        auto const k = 2. * Utils::pi() *
+                       Utils::hadamard_product(Utils::Vector3i{{mx, my, mz}},
+                                               box_geo.length_inv());
+        wave_vectors.emplace_back(k);
+        weights.emplace_back(std::exp(-exponent) / k.norm2());
+      }
+    }
+  }
+  std::vector<double> local_structure_factors(2 * wave_vectors.size(), 0.);
+  for (auto const &p : particles) {
+    if (p.q() != 0.) {
+      for (std::size_t l = 0; l < wave_vectors.size(); l++) {
+        auto const phase = wave_vectors[l] * p.pos();
+        local_structure_factors[2 * l] += p.q() * std::cos(phase);
+        local_structure_factors[2 * l + 1] += p.q() * std::sin(phase);
+      }
+    }
+  }
+  std::vector<double> structure_factors(local_structure_factors.size());
+  boost::mpi::reduce(comm_cart, local_structure_factors.data(),
+                     static_cast<int>(local_structure_factors.size()),
+                     structure_factors.data(), std::plus<double>(), 0);
+  if (this_node == 0) {
+    for (std::size_t l = 0; l < wave_vectors.size(); l++) {
+      node_energy += weights[l] * (Utils::sqr(structure_factors[2 * l]) +
+                                   Utils::sqr(structure_factors[2 * l + 1]));
+    }
+    node_energy *= 4. * Utils::pi() / volume;
+  }
+
+  auto sum_q2 = 0.;
+  auto sum_q = 0.;
+  boost::mpi::reduce(comm_cart, local_q2, sum_q2, std::plus<>(), 0);
+  boost::mpi::reduce(comm_cart, local_q, sum_q, std::plus<>(), 0);
+  if (this_node == 0) {
+    /* self energy correction */
+    node_energy -= sum_q2 * alpha * Utils::sqrt_pi_i();
+    /* net charge correction */
+    node_energy -=
+        Utils::sqr(sum_q) * Utils::pi() / (2. * volume * Utils::sqr(alpha));
+  }
+  return prefactor * node_energy;
+}
+
+#endif // ELECTROSTATICS
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Random Batch Ewald (RBE) method for long-range Coulomb interactions
+ *  @cite jin21a.
+ *
+ *  The real-space part of the Ewald sum is calculated in the short-range
+ *  loop. The k-space forces are estimated in each time step from a small
+ *  batch of wave vectors, which are importance-sampled from the Gaussian
+ *  factor of the Ewald sum. This gives an unbiased estimate of the Ewald
+ *  forces, whose variance decreases with the batch size. Only the
+ *  structure factors of the batch have to be summed over all MPI ranks.
+ *  The k-space energy is calculated with the full Ewald sum.
+ *
+ *  Implementation in rbe.cpp.
+ */
+
+#ifndef ESPRESSO_SRC_CORE_ELECTROSTATICS_RBE_HPP
+#define ESPRESSO_SRC_CORE_ELECTROSTATICS_RBE_HPP
+
+#include "config/config.hpp"
+
+#ifdef ELECTROSTATICS
+
+#include "electrostatics/actor.hpp"
+
+#include "ParticleRange.hpp"
+
+#include <utils/Counter.hpp>
+#include <utils/Vector.hpp>
+#include <utils/constants.hpp>
+#include <utils/math/AS_erfc_part.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+/** @brief Random Batch Ewald solver. */
+struct CoulombRBE : public Coulomb::Actor<CoulombRBE> {
+  /** Ewald splitting parameter. */
+  double alpha;
+  /** Real-space cutoff. */
+  double r_cut;
+  /** Number of wave vectors sampled per force calculation. */
+  int batch_size;
+  /** Seed of the wave vector sampling. */
+  std::uint32_t seed;
+  /** Counter of the wave vector sampling, incremented by each force
+   *  calculation. */
+  Utils::Counter<std::uint64_t> rng_counter;
+
+  CoulombRBE(double prefactor, double alpha, double r_cut, int batch_size,
+             int seed);
+
+  /** @brief Recalculate all derived parameters. */
+  void init();
+  void on_activation() {
+    sanity_checks();
+    init();
+  }
+  void on_boxl_change() { init(); }
+  void on_node_grid_change() const {}
+  void on_periodicity_change() const { sanity_checks_periodicity(); }
+  void on_cell_structure_change() { init(); }
+  void sanity_checks() const {
+    sanity_checks_periodicity();
+    sanity_checks_charge_neutrality();
+  }
+
+  /** Calculate real-space contribution of Coulomb pair forces. */
+  Utils::Vector3d pair_force(double q1q2, Utils::Vector3d const &d,
+                             double dist) const {
+    if ((q1q2 == 0.) || dist >= r_cut || dist <= 0.) {
+      return {};
+    }
+    auto const adist = alpha * dist;
+    auto const exp_adist_sq = exp(-adist * adist);
+    auto const dist_sq = dist * dist;
+    auto const two_a_sqrt_pi_i = 2.0 * alpha * Utils::sqrt_pi_i();
+#if USE_ERFC_APPROXIMATION
+    auto const erfc_part_ri = Utils::AS_erfc_part(adist) / dist;
+    auto const fac = exp_adist_sq * (erfc_part_ri + two_a_sqrt_pi_i) / dist_sq;
+#else
+    auto const erfc_part_ri = erfc(adist) / dist;
+    auto const fac = (erfc_part_ri + two_a_sqrt_pi_i * exp_adist_sq) / dist_sq;
+#endif
+    return (fac * prefactor * q1q2) * d;
+  }
+
+  /** Calculate real-space contribution of Coulomb pair energy. */
+  double pair_energy(double q1q2, double dist) const {
+    if ((q1q2 == 0.) || dist >= r_cut || dist <= 0.) {
+      return {};
+    }
+    auto const adist = alpha * dist;
+#if USE_ERFC_APPROXIMATION
+    auto const erfc_part_ri = Utils::AS_erfc_part(adist) / dist;
+    return prefactor * q1q2 * erfc_part_ri * exp(-adist * adist);
+#else
+    auto const erfc_part_ri = erfc(adist) / dist;
+    return prefactor * q1q2 * erfc_part_ri;
+#endif
+  }
+
+  /** Add the k-space forces, estimated from a batch of wave vectors. */
+  void add_long_range_forces(ParticleRange const &particles);
+
+  /** Compute the k-space energy with the full Ewald sum. */
+  double long_range_energy(ParticleRange const &particles);
+
+private:
+  /** Cumulative distribution of the wave vector components, for the
+   *  integers @f$ -m_{\max}, \ldots, m_{\max} @f$ in each direction. */
+  std::array<std::vector<double>, 3> m_cdf;
+  /** Sum of the Gaussian factors @f$ \exp(-k^2/(4\alpha^2)) @f$ over all
+   *  non-zero wave vectors, i.e. the normalization of the sampling. */
+  double m_sampling_norm = 0.;
+
+  /** Draw the wave vectors of the next force calculation. */
+  std::vector<Utils::Vector3d> sample_wave_vectors() const;
+  void sanity_checks_periodicity() const;
+};
+
+#endif // ELECTROSTATICS
+#endif
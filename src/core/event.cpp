@@ -177,6 +177,15 @@ void on_observable_calc() {
   clear_particle_node();
 }
 
+void on_integration_step() {
+#ifdef ELECTROSTATICS
+  Coulomb::on_integration_step();
+#endif
+#ifdef DIPOLES
+  Dipoles::on_integration_step();
+#endif
+}
+
 void on_particle_charge_change() {
 #ifdef ELECTROSTATICS
   reinit_electrostatics = true;
@@ -189,9 +198,11 @@ void on_particle_charge_change() {
 void on_particle_change() {
   if (cell_structure.decomposition_type() ==
       CellStructureType::CELL_STRUCTURE_HYBRID) {
-    cell_structure.set_resort_particles(Cells::RESORT_GLOBAL);
+    cell_structure.set_resort_particles(Cells::RESORT_GLOBAL,
+                                        Cells::REBUILD_PARTICLE_CHANGE);
   } else {
-    cell_structure.set_resort_particles(Cells::RESORT_LOCAL);
+    cell_structure.set_resort_particles(Cells::RESORT_LOCAL,
+                                        Cells::REBUILD_PARTICLE_CHANGE);
   }
 #ifdef ELECTROSTATICS
   reinit_electrostatics = true;
@@ -258,6 +269,8 @@ void on_lbboundary_change() {
 
 void on_boxl_change(bool skip_method_adaption) {
   grid_changed_box_l(box_geo);
+  cell_structure.set_resort_particles(Cells::RESORT_LOCAL,
+                                      Cells::REBUILD_BOX_CHANGE);
   /* Electrostatics cutoffs mostly depend on the system size,
    * therefore recalculate them. */
   cells_re_init(cell_structure.decomposition_type());
@@ -59,6 +59,11 @@ void on_integration_start(double time_step);
  */
 void on_observable_calc();
 
+/** called at the end of every integration step. Long-range methods can
+ *  monitor their accuracy here (P3M etc.).
+ */
+void on_integration_step();
+
 /** called every time a particle property is changed via the script interface.
  */
 void on_particle_change();
@@ -58,6 +58,7 @@
 #include <profiler/profiler.hpp>
 
 #include <cassert>
+#include <cmath>
 #include <memory>
 
 std::shared_ptr<ComFixed> comfixed = std::make_shared<ComFixed>();
@@ -94,14 +95,21 @@ inline ParticleForce thermostat_force(Particle const &p, double time_step,
     return {};
   }
 
+  // the BAOAB integrator thermalizes the translational velocities of real
+  // particles in its propagation kernel
+  auto const f_trans =
+      (integ_switch == INTEG_METHOD_BAOAB and !p.is_virtual())
+          ? Utils::Vector3d{}
+          : friction_thermo_langevin(langevin, p, time_step, kT);
+
 #ifdef ROTATION
-  return {friction_thermo_langevin(langevin, p, time_step, kT),
+  return {f_trans,
           p.can_rotate() ? convert_vector_body_to_space(
                                p, friction_thermo_langevin_rotation(
                                       langevin, p, time_step, kT))
                          : Utils::Vector3d{}};
 #else
-  return friction_thermo_langevin(langevin, p, time_step, kT);
+  return f_trans;
 #endif
 }
 
@@ -166,7 +174,11 @@ void force_calc(CellStructure &cell_structure, double time_step, double kT) {
 #endif
   init_forces(particles, ghost_particles, time_step, kT);
 
-  calc_long_range_forces(particles);
+#ifdef ELECTROSTATICS
+  /* start the k-space communication, it proceeds during the short-range loop
+   * and is completed in calc_long_range_forces() */
+  Coulomb::prepare_long_range_force(particles);
+#endif
 
   auto const elc_kernel = Coulomb::pair_force_elc_kernel();
   auto const coulomb_kernel = Coulomb::pair_force_kernel();
@@ -191,11 +203,20 @@ void force_calc(CellStructure &cell_structure, double time_step, double kT) {
       },
       [coulomb_kernel_ptr = coulomb_kernel.get_ptr(),
        dipoles_kernel_ptr = dipoles_kernel.get_ptr(),
-       elc_kernel_ptr = elc_kernel.get_ptr()](Particle &p1, Particle &p2,
-                                              Distance const &d) {
-        add_non_bonded_pair_force(p1, p2, d.vec21, sqrt(d.dist2), d.dist2,
-                                  coulomb_kernel_ptr, dipoles_kernel_ptr,
-                                  elc_kernel_ptr);
+       elc_kernel_ptr = elc_kernel.get_ptr(),
+       mixed_precision = cell_structure.use_mixed_precision](
+          Particle &p1, Particle &p2, Distance const &d) {
+        if (mixed_precision) {
+          auto const dist = static_cast<double>(
+              std::sqrt(static_cast<float>(d.dist2)));
+          add_non_bonded_pair_force<float>(
+              p1, p2, d.vec21, dist, d.dist2, coulomb_kernel_ptr,
+              dipoles_kernel_ptr, elc_kernel_ptr);
+        } else {
+          add_non_bonded_pair_force(p1, p2, d.vec21, sqrt(d.dist2), d.dist2,
+                                    coulomb_kernel_ptr, dipoles_kernel_ptr,
+                                    elc_kernel_ptr);
+        }
 #ifdef COLLISION_DETECTION
         if (collision_params.mode != CollisionModeType::OFF)
           detect_collision(p1, p2, d.dist2);
@@ -205,6 +226,8 @@ void force_calc(CellStructure &cell_structure, double time_step, double kT) {
       VerletCriterion<>{skin, interaction_range(), coulomb_cutoff,
                         dipole_cutoff, collision_detection_cutoff()});
 
+  calc_long_range_forces(particles);
+
   Constraints::constraints.add_forces(particles, get_sim_time());
 
   if (max_oif_objects) {
@@ -74,6 +74,12 @@
 
 #include <tuple>
 
+/** Calculate non-bonded pair forces.
+ *  @tparam FloatType  Floating-point type used to evaluate the Lennard-Jones
+ *                     and WCA force factors; forces are always accumulated
+ *                     in double precision.
+ */
+template <typename FloatType = double>
 inline ParticleForce calc_non_bonded_pair_force(
     Particle const &p1, Particle const &p2, IA_parameters const &ia_params,
     Utils::Vector3d const &d, double const dist,
@@ -81,13 +87,14 @@ inline ParticleForce calc_non_bonded_pair_force(
 
   ParticleForce pf{};
   double force_factor = 0;
+  [[maybe_unused]] auto const dist_fp = static_cast<FloatType>(dist);
 /* Lennard-Jones */
 #ifdef LENNARD_JONES
-  force_factor += lj_pair_force_factor(ia_params, dist);
+  force_factor += lj_pair_force_factor(ia_params, dist_fp);
 #endif
 /* WCA */
 #ifdef WCA
-  force_factor += wca_pair_force_factor(ia_params, dist);
+  force_factor += wca_pair_force_factor(ia_params, dist_fp);
 #endif
 /* Lennard-Jones generic */
 #ifdef LENNARD_JONES_GENERIC
@@ -173,7 +180,9 @@ inline ParticleForce calc_opposing_force(ParticleForce const &pf,
  *  @param[in] coulomb_kernel  %Coulomb force kernel.
  *  @param[in] dipoles_kernel  Dipolar force kernel.
  *  @param[in] elc_kernel      ELC force correction kernel.
+ *  @tparam FloatType          See @ref calc_non_bonded_pair_force.
  */
+template <typename FloatType = double>
 inline void add_non_bonded_pair_force(
     Particle &p1, Particle &p2, Utils::Vector3d const &d, double dist,
     double dist2,
@@ -191,8 +200,8 @@ inline void add_non_bonded_pair_force(
 #ifdef EXCLUSIONS
     if (do_nonbonded(p1, p2))
 #endif
-      pf += calc_non_bonded_pair_force(p1, p2, ia_params, d, dist,
-                                       coulomb_kernel);
+      pf += calc_non_bonded_pair_force<FloatType>(p1, p2, ia_params, d, dist,
+                                                  coulomb_kernel);
   }
 
   /***********************************************/
@@ -35,8 +35,10 @@
 #include "event.hpp"
 #include "grid.hpp"
 #include "grid_based_algorithms/lb_boundaries.hpp"
+#include "grid_based_algorithms/lb_refinement.hpp"
 #include "halo.hpp"
 #include "lb-d3q19.hpp"
+#include "memory_usage.hpp"
 #include "random.hpp"
 
 #include <utils/Counter.hpp>
@@ -138,6 +140,7 @@ void lb_on_param_change(LBParam param) {
     break;
   }
   lb_reinit_parameters(lbpar);
+  lb_refinement_reinit_parameters();
 }
 
 #ifdef ADDITIONAL_CHECKS
@@ -227,6 +230,12 @@ void lb_realloc_fluid(LB_FluidData &lb_fluid_a, LB_FluidData &lb_fluid_b,
   }
 }
 
+std::size_t lb_memory_usage() {
+  return (lbfluid_a.num_elements() + lbfluid_b.num_elements()) *
+             sizeof(double) +
+         MemoryUsage::heap_size(lbfields) + lb_refinement_memory_usage();
+}
+
 void lb_set_equilibrium_populations(const Lattice &lb_lattice,
                                     const LB_Parameters &lb_parameters) {
   for (Lattice::index_t index = 0; index < lb_lattice.halo_grid_volume;
@@ -272,6 +281,8 @@ void lb_init(const LB_Parameters &lb_parameters) {
 #ifdef LB_BOUNDARIES
   LBBoundaries::lb_init_boundaries();
 #endif
+
+  lb_refinement_init();
 }
 
 void lb_reinit_fluid(std::vector<LB_FluidNode> &lb_fields,
@@ -279,6 +290,7 @@ void lb_reinit_fluid(std::vector<LB_FluidNode> &lb_fields,
                      LB_Parameters const &lb_parameters) {
   lb_set_equilibrium_populations(lb_lattice, lb_parameters);
   lb_initialize_fields(lb_fields, lb_parameters, lb_lattice);
+  lb_refinement_init();
 }
 
 void lb_reinit_parameters(LB_Parameters &lb_parameters) {
@@ -616,6 +628,7 @@ void lb_sanity_checks(const LB_Parameters &lb_parameters) {
   if (lb_parameters.viscosity <= 0.0) {
     runtimeErrorMsg() << "Lattice Boltzmann fluid viscosity not set";
   }
+  lb_refinement_sanity_checks();
 }
 
 uint64_t lb_fluid_get_rng_state() {
@@ -713,6 +726,11 @@ std::array<T, 19> lb_calc_n_from_m(const std::array<T, 19> &modes) {
   return ret;
 }
 
+std::array<double, 19>
+lb_calc_populations(std::array<double, 19> const &modes) {
+  return lb_calc_n_from_m(modes);
+}
+
 Utils::Vector19d lb_get_population_from_density_momentum_density_stress(
     double density, Utils::Vector3d const &momentum_density,
     Utils::Vector6d const &stress) {
@@ -739,6 +757,11 @@ std::array<double, 19> lb_calc_modes(Lattice::index_t index,
       LB_Fluid_Ref(index, lb_fluid));
 }
 
+std::array<double, 19>
+lb_calc_modes(std::array<double, 19> const &populations) {
+  return Utils::matrix_vector_product<double, 19, e_ki>(populations);
+}
+
 template <typename T>
 std::array<T, 19> lb_relax_modes(const std::array<T, 19> &modes,
                                  const Utils::Vector<T, 3> &force_density,
@@ -783,7 +806,7 @@ std::array<T, 19> lb_relax_modes(const std::array<T, 19> &modes,
 
 template <typename T>
 std::array<T, 19> lb_thermalize_modes(
-    Lattice::index_t index, const std::array<T, 19> &modes,
+    uint64_t key, const std::array<T, 19> &modes,
     const LB_Parameters &lb_parameters,
     boost::optional<Utils::Counter<uint64_t>> const &rng_counter) {
   if (lb_parameters.kT > 0.0) {
@@ -798,10 +821,8 @@ std::array<T, 19> lb_thermalize_modes(
     auto const pref = std::sqrt(12.) * rootdensity;
 
     const ctr_type noise[4] = {
-        rng_type{}(c, {{static_cast<uint64_t>(index), 0ul}}),
-        rng_type{}(c, {{static_cast<uint64_t>(index), 1ul}}),
-        rng_type{}(c, {{static_cast<uint64_t>(index), 2ul}}),
-        rng_type{}(c, {{static_cast<uint64_t>(index), 3ul}})};
+        rng_type{}(c, {{key, 0ul}}), rng_type{}(c, {{key, 1ul}}),
+        rng_type{}(c, {{key, 2ul}}), rng_type{}(c, {{key, 3ul}})};
 
     auto rng = [&](int i) { return uniform(noise[i / 4][i % 4]) - 0.5; };
 
@@ -863,14 +884,29 @@ std::array<T, 19> lb_apply_forces(const std::array<T, 19> &modes,
            modes[14], modes[15], modes[16], modes[17], modes[18]}};
 }
 
-/**
- * @brief Relative index for the next node for each lattice velocity.
- *
- * @param lb_lattice The lattice parameters.
- * @param c Lattice velocities.
- */
-auto lb_next_offsets(const Lattice &lb_lattice,
-                     std::array<Utils::Vector3i, 19> const &c) {
+std::array<double, 19> lb_collide(std::array<double, 19> const &modes,
+                                  Utils::Vector3d const &force_density,
+                                  LB_Parameters const &lb_parameters,
+                                  uint64_t key) {
+  /* deterministic collisions */
+  auto const relaxed_modes =
+      lb_relax_modes(modes, force_density, lb_parameters);
+
+  /* fluctuating hydrodynamics */
+  auto const thermalized_modes =
+      lb_thermalize_modes(key, relaxed_modes, lb_parameters, rng_counter_fluid);
+
+  /* apply forces */
+  auto const modes_with_forces =
+      lb_apply_forces(thermalized_modes, lb_parameters, force_density);
+
+  /* transform back to populations */
+  return lb_calc_n_from_m(modes_with_forces);
+}
+
+std::array<std::ptrdiff_t, 19>
+lb_next_offsets(const Lattice &lb_lattice,
+                std::array<Utils::Vector3i, 19> const &c) {
   const Utils::Vector3<std::ptrdiff_t> strides = {
       {1, lb_lattice.halo_grid[0],
        static_cast<std::ptrdiff_t>(lb_lattice.halo_grid[0]) *
@@ -902,6 +938,8 @@ void lb_integrate() {
   }
 #endif // LB_BOUNDARIES
 
+  lb_refinement_prepare_integration();
+
   auto const next_offsets = lb_next_offsets(lblattice, D3Q19::c);
 
   Lattice::index_t index = lblattice.halo_offset;
@@ -909,25 +947,21 @@ void lb_integrate() {
     for (int y = 1; y <= lblattice.grid[1]; y++) {
       for (int x = 1; x <= lblattice.grid[0]; x++) {
         // as we only want to apply this to non-boundary nodes we can throw out
-        // the if-clause if we have a non-bounded domain
+        // the if-clause if we have a non-bounded domain; nodes covered by a
+        // refined patch are restored from the fine lattice after the step
 #ifdef LB_BOUNDARIES
-        if (!lbfields[index].boundary)
+        if (!lbfields[index].boundary && !lbfields[index].refined)
+#else
+        if (!lbfields[index].refined)
 #endif // LB_BOUNDARIES
         {
           /* calculate modes locally */
           auto const modes = lb_calc_modes(index, lbfluid);
 
-          /* deterministic collisions */
-          auto const relaxed_modes =
-              lb_relax_modes(modes, lbfields[index].force_density, lbpar);
-
-          /* fluctuating hydrodynamics */
-          auto const thermalized_modes = lb_thermalize_modes(
-              index, relaxed_modes, lbpar, rng_counter_fluid);
-
-          /* apply forces */
-          auto const modes_with_forces = lb_apply_forces(
-              thermalized_modes, lbpar, lbfields[index].force_density);
+          /* collisions, fluctuations and forces */
+          auto const populations = lb_collide(
+              modes, lbfields[index].force_density, lbpar,
+              static_cast<uint64_t>(index));
 
 #ifdef VIRTUAL_SITES_INERTIALESS_TRACERS
           // Safeguard the node forces so that we can later use them for the IBM
@@ -938,8 +972,7 @@ void lb_integrate() {
           /* reset the force density */
           lbfields[index].force_density = lbpar.ext_force_density;
 
-          /* transform back to populations and streaming */
-          auto const populations = lb_calc_n_from_m(modes_with_forces);
+          /* streaming */
           lb_stream(lbfluid_post, populations, index, next_offsets);
         }
 
@@ -955,7 +988,7 @@ void lb_integrate() {
 
 #ifdef LB_BOUNDARIES
   /* boundary conditions for links */
-  lb_bounce_back(lbfluid_post, lbpar, lbfields);
+  lb_bounce_back(lbfluid_post, lbpar, lbfields, lblattice);
 #endif // LB_BOUNDARIES
 
   /* swap the pointers for old and new population fields */
@@ -964,6 +997,9 @@ void lb_integrate() {
   halo_communication(update_halo_comm,
                      reinterpret_cast<char *>(lbfluid[0].data()));
 
+  /* sub-cycle the refined patches */
+  lb_refinement_integrate();
+
 #ifdef ADDITIONAL_CHECKS
   lb_check_halo_regions(lbfluid, lblattice);
 #endif
@@ -1246,25 +1282,26 @@ Utils::Vector6d lb_calc_pressure_tensor(std::array<double, 19> const &modes,
 
 #ifdef LB_BOUNDARIES
 void lb_bounce_back(LB_Fluid &lb_fluid, const LB_Parameters &lb_parameters,
-                    const std::vector<LB_FluidNode> &lb_fields) {
-  auto const next = lb_next_offsets(lblattice, D3Q19::c);
+                    const std::vector<LB_FluidNode> &lb_fields,
+                    const Lattice &lb_lattice) {
+  auto const next = lb_next_offsets(lb_lattice, D3Q19::c);
   static constexpr int reverse[] = {0, 2,  1,  4,  3,  6,  5,  8,  7, 10,
                                     9, 12, 11, 14, 13, 16, 15, 18, 17};
 
   /* bottom-up sweep */
-  for (int z = 0; z < lblattice.grid[2] + 2; z++) {
-    for (int y = 0; y < lblattice.grid[1] + 2; y++) {
-      for (int x = 0; x < lblattice.grid[0] + 2; x++) {
-        auto const k = get_linear_index(x, y, z, lblattice.halo_grid);
+  for (int z = 0; z < lb_lattice.grid[2] + 2; z++) {
+    for (int y = 0; y < lb_lattice.grid[1] + 2; y++) {
+      for (int x = 0; x < lb_lattice.grid[0] + 2; x++) {
+        auto const k = get_linear_index(x, y, z, lb_lattice.halo_grid);
 
-        if (lb_fields[k].boundary) {
+        if (lb_fields[k].boundary && !lb_fields[k].refined) {
           Utils::Vector3d boundary_force = {};
           for (int i = 0; i < 19; i++) {
             auto const ci = D3Q19::c[i];
 
-            if (x - ci[0] > 0 && x - ci[0] < lblattice.grid[0] + 1 &&
-                y - ci[1] > 0 && y - ci[1] < lblattice.grid[1] + 1 &&
-                z - ci[2] > 0 && z - ci[2] < lblattice.grid[2] + 1) {
+            if (x - ci[0] > 0 && x - ci[0] < lb_lattice.grid[0] + 1 &&
+                y - ci[1] > 0 && y - ci[1] < lb_lattice.grid[1] + 1 &&
+                z - ci[2] > 0 && z - ci[2] < lb_lattice.grid[2] + 1) {
               if (!lb_fields[k - next[i]].boundary) {
                 auto const population_shift =
                     -lb_parameters.density * 2 * D3Q19::w[i] *
@@ -74,6 +74,8 @@ struct LB_FluidNode {
   // Therefore we save it here
   Utils::Vector3d force_density_buf;
 #endif
+  /** flag indicating whether this site is integrated by a refined patch */
+  bool refined = false;
 };
 
 /** Data structure holding the parameters for the Lattice Boltzmann system. */
@@ -144,6 +146,9 @@ void lb_reinit_fluid(std::vector<LB_FluidNode> &lb_fields,
 
 void lb_reinit_parameters(LB_Parameters &lb_parameters);
 
+/** @brief Heap memory of the CPU fluid populations and fields, in bytes. */
+std::size_t lb_memory_usage();
+
 using LB_Fluid = std::array<Utils::Span<double>, 19>;
 extern LB_Fluid lbfluid;
 
@@ -208,6 +213,46 @@ Utils::Vector6d lb_calc_pressure_tensor(std::array<double, 19> const &modes,
 std::array<double, 19> lb_calc_modes(Lattice::index_t index,
                                      const LB_Fluid &lb_fluid);
 
+/** Calculation of hydrodynamic modes.
+ *
+ *  @param[in]  populations  Populations of a node
+ *  @retval Array containing the modes.
+ */
+std::array<double, 19>
+lb_calc_modes(std::array<double, 19> const &populations);
+
+/** Transformation of hydrodynamic modes to populations.
+ *
+ *  @param[in]  modes  Modes of a node
+ *  @retval Array containing the populations.
+ */
+std::array<double, 19> lb_calc_populations(std::array<double, 19> const &modes);
+
+/** Collision of the populations of one node.
+ *
+ *  Relaxes the modes, adds the thermal fluctuations and applies the
+ *  force density.
+ *
+ *  @param[in]  modes          Pre-collision modes of the node
+ *  @param[in]  force_density  Force density acting on the node
+ *  @param[in]  lb_parameters  LB parameters
+ *  @param[in]  key            Key of the node for the random numbers
+ *  @retval Array containing the post-collision populations.
+ */
+std::array<double, 19> lb_collide(std::array<double, 19> const &modes,
+                                  Utils::Vector3d const &force_density,
+                                  LB_Parameters const &lb_parameters,
+                                  uint64_t key);
+
+/** Relative index of the next node for each lattice velocity.
+ *
+ *  @param lb_lattice  The lattice parameters.
+ *  @param c           Lattice velocities.
+ */
+std::array<std::ptrdiff_t, 19>
+lb_next_offsets(const Lattice &lb_lattice,
+                std::array<Utils::Vector3i, 19> const &c);
+
 /**
  * @brief Get the populations as a function of density, flux density and stress.
  * @param density fluid density
@@ -246,7 +291,8 @@ void lb_prepare_communication(HaloCommunicator &halo_comm,
  * in no slip boundary conditions, cf. @cite ladd01a.
  */
 void lb_bounce_back(LB_Fluid &lbfluid, const LB_Parameters &lb_parameters,
-                    const std::vector<LB_FluidNode> &lb_fields);
+                    const std::vector<LB_FluidNode> &lb_fields,
+                    const Lattice &lb_lattice);
 
 #endif /* LB_BOUNDARIES */
 
@@ -34,6 +34,7 @@
 #include "grid_based_algorithms/lattice.hpp"
 #include "grid_based_algorithms/lb.hpp"
 #include "grid_based_algorithms/lb_interface.hpp"
+#include "grid_based_algorithms/lb_refinement.hpp"
 #include "grid_based_algorithms/lbgpu.hpp"
 #include "lbboundaries/LBBoundary.hpp"
 
@@ -266,6 +267,7 @@ void lb_init_boundaries() {
         }
       }
     }
+    lb_refinement_init_boundaries();
 #else  // defined(LB_BOUNDARIES)
     if (not lbboundaries.empty()) {
       runtimeErrorMsg()
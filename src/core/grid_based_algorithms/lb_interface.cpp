@@ -31,6 +31,7 @@
 #include "lb_collective_interface.hpp"
 #include "lb_constants.hpp"
 #include "lb_interpolation.hpp"
+#include "lb_refinement.hpp"
 #include "lbgpu.hpp"
 
 #include <utils/Vector.hpp>
@@ -851,6 +852,7 @@ void lb_lbfluid_load_checkpoint(const std::string &filename, bool binary) {
           }
         }
       }
+      lb_refinement_init();
     } else {
       throw std::runtime_error(
           "To load an LB checkpoint one needs to have already "
@@ -892,6 +894,30 @@ Utils::Vector3i lb_lbfluid_get_shape() {
   throw NoLBActive();
 }
 
+void lb_lbfluid_add_refinement_region(Utils::Vector3i const &lower,
+                                      Utils::Vector3i const &upper) {
+  if (lattice_switch == ActiveLB::GPU) {
+    throw std::runtime_error(
+        "Grid refinement is not implemented for the GPU LB.");
+  }
+  if (lattice_switch == ActiveLB::CPU) {
+    lb_refinement_add_region(lower, upper);
+    return;
+  }
+  throw NoLBActive();
+}
+
+void lb_lbfluid_clear_refinement_regions() { lb_refinement_clear_regions(); }
+
+std::vector<Utils::Vector3i> lb_lbfluid_get_refinement_regions() {
+  std::vector<Utils::Vector3i> corners;
+  for (auto const &region : lb_refinement_get_regions()) {
+    corners.emplace_back(region.first);
+    corners.emplace_back(region.second);
+  }
+  return corners;
+}
+
 bool lb_lbnode_is_index_valid(Utils::Vector3i const &ind) {
   auto const limit = lb_lbfluid_get_shape();
   return ind < limit && ind >= Utils::Vector3i{};
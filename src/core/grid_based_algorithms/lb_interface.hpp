@@ -248,6 +248,24 @@ bool lb_lbnode_is_index_valid(const Utils::Vector3i &ind);
  */
 Utils::Vector3i lb_lbfluid_get_shape();
 
+/**
+ * @brief Refine a cuboid region of the CPU LB lattice by a factor 2.
+ * @param lower Node index of the lower corner of the region
+ * @param upper Node index of the upper corner of the region
+ */
+void lb_lbfluid_add_refinement_region(const Utils::Vector3i &lower,
+                                      const Utils::Vector3i &upper);
+
+/**
+ * @brief Remove all refined regions of the CPU LB lattice.
+ */
+void lb_lbfluid_clear_refinement_regions();
+
+/**
+ * @brief Node indices of the lower and upper corners of the refined regions.
+ */
+std::vector<Utils::Vector3i> lb_lbfluid_get_refinement_regions();
+
 Utils::Vector3d lb_lbfluid_calc_fluid_momentum();
 
 /**
@@ -23,12 +23,14 @@
 #include "config/config.hpp"
 #include "grid_based_algorithms/lattice.hpp"
 #include "lb.hpp"
+#include "lb_refinement.hpp"
 
 #include <utils/Vector.hpp>
 
 #include <algorithm>
 #include <cstddef>
 #include <stdexcept>
+#include <vector>
 
 namespace {
 InterpolationOrder interpolation_order = InterpolationOrder::linear;
@@ -71,25 +73,29 @@ void lattice_interpolation(Lattice const &lattice, Utils::Vector3d const &pos,
   }
 }
 
-Utils::Vector3d node_u(Lattice::index_t index) {
+Utils::Vector3d node_u(Lattice::index_t index, LB_Fluid const &lb_fluid,
+                       std::vector<LB_FluidNode> const &lb_fields,
+                       LB_Parameters const &lb_parameters) {
 #ifdef LB_BOUNDARIES
-  if (lbfields[index].boundary) {
-    return lbfields[index].slip_velocity;
+  if (lb_fields[index].boundary) {
+    return lb_fields[index].slip_velocity;
   }
 #endif // LB_BOUNDARIES
-  auto const modes = lb_calc_modes(index, lbfluid);
-  auto const local_density = lbpar.density + modes[0];
+  auto const modes = lb_calc_modes(index, lb_fluid);
+  auto const local_density = lb_parameters.density + modes[0];
   return Utils::Vector3d{modes[1], modes[2], modes[3]} / local_density;
 }
 
-double node_dens(Lattice::index_t index) {
+double node_dens(Lattice::index_t index, LB_Fluid const &lb_fluid,
+                 std::vector<LB_FluidNode> const &lb_fields,
+                 LB_Parameters const &lb_parameters) {
 #ifdef LB_BOUNDARIES
-  if (lbfields[index].boundary) {
-    return lbpar.density;
+  if (lb_fields[index].boundary) {
+    return lb_parameters.density;
   }
 #endif // LB_BOUNDARIES
-  auto const modes = lb_calc_modes(index, lbfluid);
-  return lbpar.density + modes[0];
+  auto const modes = lb_calc_modes(index, lb_fluid);
+  return lb_parameters.density + modes[0];
 }
 
 } // namespace
@@ -100,9 +106,19 @@ lb_lbinterpolation_get_interpolated_velocity(const Utils::Vector3d &pos) {
 
   /* Calculate fluid velocity at particle's position.
      This is done by linear interpolation (eq. (11) @cite ahlrichs99a) */
+  if (auto const level = lb_refinement_find_level(pos)) {
+    lattice_interpolation(level->lattice, pos,
+                          [&](Lattice::index_t index, double w) {
+                            interpolated_u +=
+                                w * node_u(index, level->fluid, level->fields,
+                                           level->parameters);
+                          });
+    return interpolated_u;
+  }
   lattice_interpolation(lblattice, pos,
                         [&interpolated_u](Lattice::index_t index, double w) {
-                          interpolated_u += w * node_u(index);
+                          interpolated_u +=
+                              w * node_u(index, lbfluid, lbfields, lbpar);
                         });
 
   return interpolated_u;
@@ -113,9 +129,20 @@ double lb_lbinterpolation_get_interpolated_density(const Utils::Vector3d &pos) {
 
   /* Calculate fluid density at the position.
      This is done by linear interpolation (eq. (11) @cite ahlrichs99a) */
+  if (auto const level = lb_refinement_find_level(pos)) {
+    lattice_interpolation(level->lattice, pos,
+                          [&](Lattice::index_t index, double w) {
+                            interpolated_dens +=
+                                w * node_dens(index, level->fluid,
+                                              level->fields, level->parameters);
+                          });
+    /* convert to the mass of a coarse node */
+    return interpolated_dens * lbpar.density / level->parameters.density;
+  }
   lattice_interpolation(lblattice, pos,
                         [&interpolated_dens](Lattice::index_t index, double w) {
-                          interpolated_dens += w * node_dens(index);
+                          interpolated_dens +=
+                              w * node_dens(index, lbfluid, lbfields, lbpar);
                         });
 
   return interpolated_dens;
@@ -128,6 +155,14 @@ void lb_lbinterpolation_add_force_density(
     throw std::runtime_error("The non-linear interpolation scheme is not "
                              "implemented for the CPU LB.");
   case (InterpolationOrder::linear):
+    if (auto const level = lb_refinement_find_level(pos)) {
+      lattice_interpolation(level->lattice, pos,
+                            [&](Lattice::index_t index, double w) {
+                              auto &field = level->fields[index];
+                              field.force_density += w * force_density;
+                            });
+      break;
+    }
     lattice_interpolation(lblattice, pos,
                           [&force_density](Lattice::index_t index, double w) {
                             auto &field = lbfields[index];
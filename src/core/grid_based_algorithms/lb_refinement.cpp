@@ -0,0 +1,639 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/** \file
+ *
+ *  Static grid refinement of the CPU lattice-Boltzmann fluid.
+ *
+ *  The corresponding header file is lb_refinement.hpp.
+ */
+
+#include "grid_based_algorithms/lb_refinement.hpp"
+
+#include "communication.hpp"
+#include "config/config.hpp"
+#include "errorhandling.hpp"
+#include "grid.hpp"
+#include "grid_based_algorithms/lattice.hpp"
+#include "grid_based_algorithms/lb-d3q19.hpp"
+#include "grid_based_algorithms/lb.hpp"
+#include "grid_based_algorithms/lb_boundaries.hpp"
+#include "memory_usage.hpp"
+
+#include <utils/Span.hpp>
+#include <utils/Vector.hpp>
+#include <utils/index.hpp>
+#include <utils/math/sqr.hpp>
+
+#include <boost/range/adaptor/reversed.hpp>
+#include <boost/range/algorithm.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using Utils::get_linear_index;
+
+namespace {
+
+using Populations = std::array<double, 19>;
+
+Populations get_populations(LB_Fluid const &lb_fluid, std::size_t index) {
+  Populations populations;
+  for (int i = 0; i < D3Q19::n_vel; i++) {
+    populations[i] = lb_fluid[i][index];
+  }
+  return populations;
+}
+
+void set_populations(LB_Fluid &lb_fluid, std::size_t index,
+                     Populations const &populations) {
+  for (int i = 0; i < D3Q19::n_vel; i++) {
+    lb_fluid[i][index] = populations[i];
+  }
+}
+
+/** Loop over the nodes of a box, bounds included. */
+template <class Kernel>
+void for_each_node(Utils::Vector3i const &lower, Utils::Vector3i const &upper,
+                   Kernel &&kernel) {
+  Utils::Vector3i node;
+  for (node[2] = lower[2]; node[2] <= upper[2]; node[2]++) {
+    for (node[1] = lower[1]; node[1] <= upper[1]; node[1]++) {
+      for (node[0] = lower[0]; node[0] <= upper[0]; node[0]++) {
+        kernel(node);
+      }
+    }
+  }
+}
+
+/** Linear index of a node of the coarse lattice. Patches only exist on a
+ *  single MPI rank, where the local lattice is the global lattice.
+ */
+std::size_t coarse_index(Utils::Vector3i const &node) {
+  return get_linear_index(node + Utils::Vector3i::broadcast(1),
+                          lblattice.halo_grid);
+}
+
+/** Relaxation time of a mode with relaxation parameter @p gamma. */
+double relaxation_time(double gamma) { return 1. / (1. - gamma); }
+
+/** Transfer the modes of a node between two lattice levels.
+ *
+ *  The conserved modes and the equilibrium part of the stress modes scale
+ *  with the mass of a node. The momentum is transferred including half of
+ *  the external force density of the time step, as in the velocity of
+ *  the collision. The non-equilibrium parts scale in addition with the
+ *  velocity gradients in lattice units and with the relaxation times of
+ *  the modes.
+ *
+ *  @param modes           Modes of the node on the source level
+ *  @param src             Parameters of the source level
+ *  @param dst             Parameters of the destination level
+ *  @param mass_ratio      Ratio of the node masses
+ *  @param gradient_ratio  Ratio of the velocity gradients in lattice units
+ */
+std::array<double, 19> transfer_modes(std::array<double, 19> const &modes,
+                                      LB_Parameters const &src,
+                                      LB_Parameters const &dst,
+                                      double mass_ratio,
+                                      double gradient_ratio) {
+  using Utils::sqr;
+  auto const density = modes[0] + src.density;
+  auto const j = Utils::Vector3d{modes[1], modes[2], modes[3]} +
+                 0.5 * src.ext_force_density;
+  auto const j2 = j.norm2();
+  auto const stress_eq =
+      Utils::Vector6d{j2,          sqr(j[0]) - sqr(j[1]), j2 - 3. * sqr(j[2]),
+                      j[0] * j[1], j[0] * j[2],           j[1] * j[2]} /
+      density;
+  auto const j_dst = mass_ratio * j - 0.5 * dst.ext_force_density;
+  auto const neq_ratio = [=](double gamma_src, double gamma_dst) {
+    return mass_ratio * gradient_ratio * relaxation_time(gamma_dst) /
+           relaxation_time(gamma_src);
+  };
+  auto const bulk = neq_ratio(src.gamma_bulk, dst.gamma_bulk);
+  auto const shear = neq_ratio(src.gamma_shear, dst.gamma_shear);
+  auto const odd = neq_ratio(src.gamma_odd, dst.gamma_odd);
+  auto const even = neq_ratio(src.gamma_even, dst.gamma_even);
+
+  std::array<double, 19> result;
+  result[0] = mass_ratio * modes[0];
+  for (int i = 0; i < 3; i++) {
+    result[i + 1] = j_dst[i];
+  }
+  result[4] = mass_ratio * stress_eq[0] + bulk * (modes[4] - stress_eq[0]);
+  for (int i = 5; i < 10; i++) {
+    result[i] =
+        mass_ratio * stress_eq[i - 4] + shear * (modes[i] - stress_eq[i - 4]);
+  }
+  for (int i = 10; i < 16; i++) {
+    result[i] = odd * modes[i];
+  }
+  for (int i = 16; i < 19; i++) {
+    result[i] = even * modes[i];
+  }
+  return result;
+}
+
+/** Parameters of a fine lattice with half the lattice constant and half
+ *  the time step of the coarse lattice. The lattice speed is the same on
+ *  both levels, and the viscosities are the same in MD units.
+ */
+LB_Parameters fine_parameters(LB_Parameters const &coarse) {
+  auto fine = coarse;
+  fine.agrid = coarse.agrid / 2.;
+  fine.tau = coarse.tau / 2.;
+  fine.density = coarse.density / 8.;
+  fine.viscosity = 2. * coarse.viscosity;
+  /* bulk viscosity of the coarse relaxation rate, which is only set
+   * by the bulk viscosity if the latter is given */
+  fine.bulk_viscosity = 2. * (2. / (1. - coarse.gamma_bulk) - 1.) / 9.;
+  fine.ext_force_density = coarse.ext_force_density / 16.;
+  lb_reinit_parameters(fine);
+  return fine;
+}
+
+/** Refined patch covering the coarse nodes from @c lower to @c upper.
+ *
+ *  Fine node @c j of the patch coincides with the coarse node
+ *  @c lower + @c j / 2 for even @c j. The fine nodes on the outer faces
+ *  are driven by the coarse lattice. The coarse nodes of the inner box
+ *  @c lower + 1 to @c upper - 1 are restored from the patch, and the nodes
+ *  of the box @c lower + 2 to @c upper - 2 are not integrated on the coarse
+ *  lattice.
+ */
+class Patch {
+public:
+  Patch(Utils::Vector3i const &lower, Utils::Vector3i const &upper)
+      : m_lower(lower), m_upper(upper), m_cells(upper - lower) {}
+
+  Utils::Vector3i const &lower() const { return m_lower; }
+  Utils::Vector3i const &upper() const { return m_upper; }
+  LBFineLevel &level() { return m_level; }
+
+  /** Number of fine nodes, halo included. */
+  std::size_t volume() const {
+    return static_cast<std::size_t>(m_level.lattice.halo_grid_volume);
+  }
+
+  /** Whether a boundary crosses the layer of fine nodes between the outer
+   *  faces and the first restored coarse nodes.
+   */
+  bool boundary_at_interface() const { return m_interface_boundary; }
+
+  /** @brief Set up the fine lattice and initialize it from the coarse one.
+   *  @param rng_offset  Offset of the keys of the fine nodes for the
+   *                     random numbers
+   */
+  void init(uint64_t rng_offset) {
+    m_rng_offset = rng_offset;
+    m_level.parameters = fine_parameters(lbpar);
+
+    auto const agrid = lblattice.agrid / 2.;
+    auto const n_nodes = 2 * m_cells + Utils::Vector3i::broadcast(1);
+    auto const local_box = static_cast<Utils::Vector3d>(n_nodes) * agrid;
+    auto const origin = (static_cast<Utils::Vector3d>(m_lower) +
+                         Utils::Vector3d::broadcast(0.25)) *
+                        lblattice.agrid;
+    m_level.lattice =
+        Lattice(agrid, 0.5 /*offset*/, 1 /*halo size*/, local_box,
+                origin + local_box, box_geo.length(), Utils::Vector3i{},
+                Utils::Vector3i::broadcast(1));
+
+    /* allocate memory for data structures */
+    auto const volume = this->volume();
+    m_data.assign(2 * D3Q19::n_vel * volume, 0.);
+    for (int i = 0; i < D3Q19::n_vel; i++) {
+      m_level.fluid[i] =
+          Utils::Span<double>(m_data.data() + i * volume, volume);
+      m_fluid_post[i] = Utils::Span<double>(
+          m_data.data() + (D3Q19::n_vel + i) * volume, volume);
+    }
+    m_level.fields.assign(volume, LB_FluidNode{});
+    for (auto &field : m_level.fields) {
+      field.force_density = m_level.parameters.ext_force_density;
+    }
+    m_coarse_state.resize(
+        Utils::product(m_cells + Utils::Vector3i::broadcast(1)));
+
+    auto const current_state = [](Utils::Vector3i const &node) {
+      return get_populations(lbfluid, coarse_index(node));
+    };
+    for_each_node(Utils::Vector3i{}, 2 * m_cells,
+                  [&](Utils::Vector3i const &node) {
+                    set_from_coarse(node, current_state);
+                  });
+
+    init_boundaries();
+
+    for_each_node(m_lower + Utils::Vector3i::broadcast(2),
+                  m_upper - Utils::Vector3i::broadcast(2),
+                  [](Utils::Vector3i const &node) {
+                    lbfields[coarse_index(node)].refined = true;
+                  });
+  }
+
+  void reinit_parameters() {
+    auto const old_ext_force_density = m_level.parameters.ext_force_density;
+    m_level.parameters = fine_parameters(lbpar);
+    for (auto &field : m_level.fields) {
+      field.force_density +=
+          m_level.parameters.ext_force_density - old_ext_force_density;
+    }
+  }
+
+  void init_boundaries() {
+#ifdef LB_BOUNDARIES
+    using LBBoundaries::lbboundaries;
+    m_interface_boundary = false;
+    auto const vel_conv = lbpar.tau / lbpar.agrid;
+    auto const last = 2 * m_cells;
+
+    for_each_node(Utils::Vector3i{}, last, [&](Utils::Vector3i const &node) {
+      auto const pos = position(node);
+      auto const boundary = boost::find_if(
+          lbboundaries | boost::adaptors::reversed,
+          [&pos](auto const lbb) { return lbb->shape().is_inside(pos); });
+      auto &field = m_level.fields[index(node)];
+      if (boundary != boost::rend(lbboundaries)) {
+        field.boundary = static_cast<int>(
+            std::distance(lbboundaries.begin(), boundary.base()));
+        field.slip_velocity = (*boundary)->velocity() * vel_conv;
+        for (int i = 0; i < 3; i++) {
+          if (node[i] <= 2 or node[i] >= last[i] - 2) {
+            m_interface_boundary = true;
+          }
+        }
+      } else {
+        field.boundary = 0;
+      }
+    });
+#endif // LB_BOUNDARIES
+  }
+
+  /** Whether all fine nodes surrounding @p pos are driven by the patch. */
+  bool covers(Utils::Vector3d const &pos) const {
+    for (int i = 0; i < 3; i++) {
+      auto const rel = (pos[i] - (m_lower[i] + 0.5) * lblattice.agrid) /
+                       m_level.lattice.agrid;
+      if (rel < 1. or rel > 2. * m_cells[i] - 1.) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /** Save the coarse fluid at the beginning of the LB time step and move
+   *  the force densities from the restored coarse nodes to the fine nodes.
+   */
+  void prepare_integration() {
+    auto const shape = m_cells + Utils::Vector3i::broadcast(1);
+    for_each_node(Utils::Vector3i{}, m_cells, [&](Utils::Vector3i const &c) {
+      m_coarse_state[get_linear_index(c, shape)] =
+          get_populations(lbfluid, coarse_index(m_lower + c));
+    });
+    for_each_node(Utils::Vector3i::broadcast(1),
+                  m_cells - Utils::Vector3i::broadcast(1),
+                  [&](Utils::Vector3i const &c) {
+                    auto &coarse = lbfields[coarse_index(m_lower + c)];
+                    m_level.fields[index(2 * c)].force_density +=
+                        coarse.force_density - lbpar.ext_force_density;
+                    coarse.force_density = lbpar.ext_force_density;
+                  });
+  }
+
+  void integrate() {
+    /* the momentum deposited during the LB time step is applied in equal
+     * parts in both sub-steps */
+    auto const &ext_force_density = m_level.parameters.ext_force_density;
+    for (auto &field : m_level.fields) {
+      field.force_density =
+          ext_force_density + 0.5 * (field.force_density - ext_force_density);
+    }
+
+    sub_step(0);
+    sub_step(1);
+
+    /* restore the inner coarse nodes */
+    for_each_node(Utils::Vector3i::broadcast(1),
+                  m_cells - Utils::Vector3i::broadcast(1),
+                  [&](Utils::Vector3i const &c) {
+                    auto const fine_index = index(2 * c);
+#ifdef LB_BOUNDARIES
+                    if (m_level.fields[fine_index].boundary)
+                      return;
+#endif // LB_BOUNDARIES
+                    auto const modes = transfer_modes(
+                        lb_calc_modes(fine_index, m_level.fluid),
+                        m_level.parameters, lbpar, 8., 2.);
+                    set_populations(lbfluid, coarse_index(m_lower + c),
+                                    lb_calc_populations(modes));
+                  });
+  }
+
+  std::size_t memory_usage() const {
+    return MemoryUsage::heap_size(m_data) +
+           MemoryUsage::heap_size(m_level.fields) +
+           MemoryUsage::heap_size(m_coarse_state);
+  }
+
+private:
+  std::size_t index(Utils::Vector3i const &node) const {
+    return get_linear_index(node + Utils::Vector3i::broadcast(1),
+                            m_level.lattice.halo_grid);
+  }
+
+  Utils::Vector3d position(Utils::Vector3i const &node) const {
+    return (static_cast<Utils::Vector3d>(m_lower) +
+            Utils::Vector3d::broadcast(0.5)) *
+               lblattice.agrid +
+           static_cast<Utils::Vector3d>(node) * m_level.lattice.agrid;
+  }
+
+  /** Interpolate the coarse populations at a fine node.
+   *  Between two coarse nodes, the populations are interpolated with a
+   *  quadratic polynomial through three coarse nodes of the patch, which
+   *  is exact for the parabolic velocity profiles of flows driven by
+   *  constant force densities.
+   *  @param node    Fine node
+   *  @param source  Populations of a coarse node relative to @c m_lower
+   */
+  template <class Source>
+  Populations interpolate_coarse(Utils::Vector3i const &node,
+                                 Source const &source) const {
+    /* coarse nodes and weights of the stencil in each direction */
+    std::array<std::array<int, 3>, 3> stencil_nodes;
+    std::array<std::array<double, 3>, 3> stencil_weights;
+    for (int i = 0; i < 3; i++) {
+      auto const c = node[i] / 2;
+      if (node[i] % 2 == 0) {
+        stencil_nodes[i] = {c, c, c};
+        stencil_weights[i] = {1., 0., 0.};
+      } else if (c > 0) {
+        stencil_nodes[i] = {c - 1, c, c + 1};
+        stencil_weights[i] = {-1. / 8., 3. / 4., 3. / 8.};
+      } else {
+        stencil_nodes[i] = {c, c + 1, c + 2};
+        stencil_weights[i] = {3. / 8., 3. / 4., -1. / 8.};
+      }
+    }
+    Populations result{};
+    for (int a = 0; a < 3; a++) {
+      for (int b = 0; b < 3; b++) {
+        for (int d = 0; d < 3; d++) {
+          auto const weight = stencil_weights[0][a] * stencil_weights[1][b] *
+                              stencil_weights[2][d];
+          if (weight == 0.) {
+            continue;
+          }
+          auto const populations = source(Utils::Vector3i{
+              stencil_nodes[0][a], stencil_nodes[1][b], stencil_nodes[2][d]});
+          for (int i = 0; i < D3Q19::n_vel; i++) {
+            result[i] += weight * populations[i];
+          }
+        }
+      }
+    }
+    return result;
+  }
+
+  template <class Source>
+  void set_from_coarse(Utils::Vector3i const &node, Source const &source) {
+    auto const coarse_state = [&](Utils::Vector3i const &c) {
+      return source(m_lower + c);
+    };
+    auto const modes =
+        transfer_modes(lb_calc_modes(interpolate_coarse(node, coarse_state)),
+                       lbpar, m_level.parameters, 1. / 8., 0.5);
+    set_populations(m_level.fluid, index(node), lb_calc_populations(modes));
+  }
+
+  void sub_step(int step) {
+    auto const last = 2 * m_cells;
+    auto const shape = m_cells + Utils::Vector3i::broadcast(1);
+
+    /* drive the outer faces with the coarse fluid, interpolated in time */
+    auto const alpha = 0.5 * step;
+    auto const coarse_state = [&](Utils::Vector3i const &node) {
+      auto const &old_state = m_coarse_state[get_linear_index(
+          node - m_lower, shape)];
+      auto const new_state = get_populations(lbfluid, coarse_index(node));
+      Populations result;
+      for (int i = 0; i < D3Q19::n_vel; i++) {
+        result[i] = (1. - alpha) * old_state[i] + alpha * new_state[i];
+      }
+      return result;
+    };
+    for_each_node(Utils::Vector3i{}, last, [&](Utils::Vector3i const &node) {
+      for (int i = 0; i < 3; i++) {
+        if (node[i] == 0 or node[i] == last[i]) {
+          set_from_coarse(node, coarse_state);
+          return;
+        }
+      }
+    });
+
+    /* collisions and streaming (push scheme) */
+    auto const next_offsets = lb_next_offsets(m_level.lattice, D3Q19::c);
+    for_each_node(Utils::Vector3i{}, last, [&](Utils::Vector3i const &node) {
+      auto const fine_index = index(node);
+      auto &field = m_level.fields[fine_index];
+#ifdef LB_BOUNDARIES
+      if (field.boundary)
+        return;
+#endif // LB_BOUNDARIES
+      auto const modes = lb_calc_modes(fine_index, m_level.fluid);
+      auto const populations =
+          lb_collide(modes, field.force_density, m_level.parameters,
+                     m_rng_offset + 2u * fine_index + step);
+      if (step == 1) {
+        field.force_density = m_level.parameters.ext_force_density;
+      }
+      for (int i = 0; i < D3Q19::n_vel; i++) {
+        m_fluid_post[i][fine_index + next_offsets[i]] = populations[i];
+      }
+    });
+
+#ifdef LB_BOUNDARIES
+    lb_bounce_back(m_fluid_post, m_level.parameters, m_level.fields,
+                   m_level.lattice);
+#endif // LB_BOUNDARIES
+
+    std::swap(m_level.fluid, m_fluid_post);
+  }
+
+  Utils::Vector3i m_lower;
+  Utils::Vector3i m_upper;
+  /** number of coarse lattice cells in each direction */
+  Utils::Vector3i m_cells;
+  LBFineLevel m_level;
+  /** Populations of the fine lattice, pre- and post-collision */
+  std::vector<double> m_data;
+  LB_Fluid m_fluid_post;
+  /** Coarse populations at the beginning of the LB time step */
+  std::vector<Populations> m_coarse_state;
+  uint64_t m_rng_offset = 0u;
+  bool m_interface_boundary = false;
+};
+
+std::vector<std::unique_ptr<Patch>> patches;
+
+/** Offset of the keys for the random numbers of a patch, such that the
+ *  keys of all nodes in both sub-steps are distinct from each other and
+ *  from the keys of the coarse nodes.
+ */
+uint64_t rng_offset(std::size_t n_previous_patches) {
+  auto offset = static_cast<uint64_t>(lblattice.halo_grid_volume);
+  for (std::size_t i = 0; i < n_previous_patches; i++) {
+    offset += 2u * patches[i]->volume();
+  }
+  return offset;
+}
+
+void check_region(Utils::Vector3i const &lower, Utils::Vector3i const &upper) {
+  if (comm_cart.size() != 1) {
+    throw std::runtime_error("LB grid refinement requires a single MPI rank");
+  }
+  for (int i = 0; i < 3; i++) {
+    if (upper[i] - lower[i] < 4) {
+      throw std::invalid_argument("Refined region must span at least 4 "
+                                  "lattice cells in each direction");
+    }
+    if (lower[i] < 0 or upper[i] >= lblattice.grid[i]) {
+      throw std::invalid_argument("Refined region must lie inside the "
+                                  "lattice");
+    }
+  }
+  for (auto const &patch : patches) {
+    auto overlap = true;
+    for (int i = 0; i < 3; i++) {
+      overlap = overlap and lower[i] <= patch->upper()[i] and
+                patch->lower()[i] <= upper[i];
+    }
+    if (overlap) {
+      throw std::invalid_argument("Refined regions must not overlap");
+    }
+  }
+}
+
+void reset_refined_flags() {
+  for (auto &field : lbfields) {
+    field.refined = false;
+  }
+}
+
+} // namespace
+
+void lb_refinement_add_region(Utils::Vector3i const &lower,
+                              Utils::Vector3i const &upper) {
+  check_region(lower, upper);
+  patches.emplace_back(std::make_unique<Patch>(lower, upper));
+  patches.back()->init(rng_offset(patches.size() - 1u));
+}
+
+void lb_refinement_clear_regions() {
+  patches.clear();
+  reset_refined_flags();
+}
+
+std::vector<std::pair<Utils::Vector3i, Utils::Vector3i>>
+lb_refinement_get_regions() {
+  std::vector<std::pair<Utils::Vector3i, Utils::Vector3i>> regions;
+  for (auto const &patch : patches) {
+    regions.emplace_back(patch->lower(), patch->upper());
+  }
+  return regions;
+}
+
+void lb_refinement_init() {
+  if (patches.empty()) {
+    return;
+  }
+  auto const regions = lb_refinement_get_regions();
+  lb_refinement_clear_regions();
+  try {
+    for (auto const &region : regions) {
+      lb_refinement_add_region(region.first, region.second);
+    }
+  } catch (std::exception const &err) {
+    lb_refinement_clear_regions();
+    runtimeErrorMsg() << err.what();
+  }
+}
+
+void lb_refinement_reinit_parameters() {
+  for (auto &patch : patches) {
+    patch->reinit_parameters();
+  }
+}
+
+void lb_refinement_init_boundaries() {
+  for (auto &patch : patches) {
+    patch->init_boundaries();
+  }
+}
+
+void lb_refinement_sanity_checks() {
+  if (patches.empty()) {
+    return;
+  }
+  if (comm_cart.size() != 1) {
+    runtimeErrorMsg() << "LB grid refinement requires a single MPI rank";
+  }
+  for (auto const &patch : patches) {
+    if (patch->boundary_at_interface()) {
+      runtimeErrorMsg()
+          << "LB boundaries must not cross the interface of a refined region";
+    }
+  }
+}
+
+void lb_refinement_prepare_integration() {
+  for (auto &patch : patches) {
+    patch->prepare_integration();
+  }
+}
+
+void lb_refinement_integrate() {
+  for (auto &patch : patches) {
+    patch->integrate();
+  }
+}
+
+LBFineLevel *lb_refinement_find_level(Utils::Vector3d const &pos) {
+  for (auto &patch : patches) {
+    if (patch->covers(pos)) {
+      return &patch->level();
+    }
+  }
+  return nullptr;
+}
+
+std::size_t lb_refinement_memory_usage() {
+  std::size_t bytes = 0u;
+  for (auto const &patch : patches) {
+    bytes += patch->memory_usage();
+  }
+  return bytes;
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef SRC_CORE_GRID_BASED_ALGORITHMS_LB_REFINEMENT_HPP
+#define SRC_CORE_GRID_BASED_ALGORITHMS_LB_REFINEMENT_HPP
+/** \file
+ *
+ *  Static grid refinement of the CPU lattice-Boltzmann fluid.
+ *
+ *  Cuboid regions of the lattice can be covered by patches with half the
+ *  lattice constant, which are integrated with two sub-steps of half the
+ *  LB time step per LB time step. The two levels are coupled as described
+ *  in @cite dupuis03a: the populations on the outer faces of a patch are
+ *  interpolated in space and time from the coarse lattice, and the coarse
+ *  nodes covered by the patch are restored from the coincident fine nodes
+ *  after each LB time step. The non-equilibrium part of the populations
+ *  is rescaled when passing between the levels, such that the viscous
+ *  stress is continuous across the interface.
+ *
+ *  Particles inside a patch couple to the fine lattice. Only one level of
+ *  refinement is supported, and only on a single MPI rank.
+ *
+ *  Implementation in lb_refinement.cpp.
+ */
+
+#include "grid_based_algorithms/lattice.hpp"
+#include "grid_based_algorithms/lb.hpp"
+
+#include <utils/Vector.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/** Fine lattice of a refined patch. */
+struct LBFineLevel {
+  /** The underlying lattice */
+  Lattice lattice;
+  /** %Lattice Boltzmann parameters, in units of the fine lattice */
+  LB_Parameters parameters;
+  /** Populations of the fluid */
+  LB_Fluid fluid;
+  /** Hydrodynamic fields of the fluid */
+  std::vector<LB_FluidNode> fields;
+};
+
+/** @brief Cover a cuboid region of the lattice with a refined patch.
+ *  The fluid in the patch is initialized from the coarse lattice.
+ *  @param lower  Index of the lower corner node of the region
+ *  @param upper  Index of the upper corner node of the region
+ */
+void lb_refinement_add_region(Utils::Vector3i const &lower,
+                              Utils::Vector3i const &upper);
+
+/** @brief Remove all refined patches. */
+void lb_refinement_clear_regions();
+
+/** @brief Lower and upper corner nodes of the refined regions. */
+std::vector<std::pair<Utils::Vector3i, Utils::Vector3i>>
+lb_refinement_get_regions();
+
+/** @brief Rebuild the patches and initialize them from the coarse lattice. */
+void lb_refinement_init();
+
+/** @brief Update the patches after a change of the LB parameters. */
+void lb_refinement_reinit_parameters();
+
+/** @brief Update the boundary flags of the fine lattices. */
+void lb_refinement_init_boundaries();
+
+void lb_refinement_sanity_checks();
+
+/** @brief Save the coarse fluid needed to drive the patches.
+ *  Called before the collisions on the coarse lattice.
+ */
+void lb_refinement_prepare_integration();
+
+/** @brief Integrate the patches for one LB time step.
+ *  Called after the streaming on the coarse lattice.
+ */
+void lb_refinement_integrate();
+
+/** @brief Fine lattice to interpolate on at a position.
+ *  @param pos  Position
+ *  @return The fine level whose interior contains @p pos, or nullptr.
+ */
+LBFineLevel *lb_refinement_find_level(Utils::Vector3d const &pos);
+
+/** @brief Heap memory of the fine lattices, in bytes. */
+std::size_t lb_refinement_memory_usage();
+
+#endif
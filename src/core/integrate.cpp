@@ -27,6 +27,8 @@
  */
 
 #include "integrate.hpp"
+#include "integrators/adaptive_time_step.hpp"
+#include "integrators/baoab_inline.hpp"
 #include "integrators/brownian_inline.hpp"
 #include "integrators/steepest_descent.hpp"
 #include "integrators/stokesian_dynamics_inline.hpp"
@@ -54,10 +56,12 @@
 #include "rotation.hpp"
 #include "signalhandling.hpp"
 #include "thermostat.hpp"
+#include "tuning.hpp"
 #include "virtual_sites.hpp"
 
 #include <profiler/profiler.hpp>
 
+#include <boost/mpi/collectives/all_reduce.hpp>
 #include <boost/mpi/collectives/reduce.hpp>
 #include <boost/range/algorithm/min_element.hpp>
 
@@ -118,14 +122,16 @@ void set_protocol(std::shared_ptr<ActiveProtocol> new_protocol) {
   protocol = std::move(new_protocol);
   LeesEdwards::update_box_params();
   ::recalc_forces = true;
-  cell_structure.set_resort_particles(Cells::RESORT_LOCAL);
+  cell_structure.set_resort_particles(Cells::RESORT_LOCAL,
+                                      Cells::REBUILD_BOX_CHANGE);
 }
 
 void unset_protocol() {
   protocol = nullptr;
   box_geo.set_type(BoxType::CUBOID);
   ::recalc_forces = true;
-  cell_structure.set_resort_particles(Cells::RESORT_LOCAL);
+  cell_structure.set_resort_particles(Cells::RESORT_LOCAL,
+                                      Cells::REBUILD_BOX_CHANGE);
 }
 
 template <class Kernel> void run_kernel() {
@@ -171,23 +177,64 @@ void integrator_sanity_checks() {
       runtimeErrorMsg() << "The SD integrator requires the SD thermostat";
     break;
 #endif
+  case INTEG_METHOD_BAOAB:
+    if (thermo_switch & (THERMO_NPT_ISO | THERMO_BROWNIAN | THERMO_SD))
+      runtimeErrorMsg() << "The BAOAB integrator is incompatible with the "
+                           "currently active combination of thermostats";
+    break;
   default:
     runtimeErrorMsg() << "Unknown value for integ_switch";
   }
+  if (get_adaptive_time_step()) {
+    if (integ_switch != INTEG_METHOD_NVT and integ_switch != INTEG_METHOD_BAOAB)
+      runtimeErrorMsg() << "Adaptive time steps are only supported by the VV "
+                           "and BAOAB integrators";
+    if (lb_lbfluid_get_lattice_switch() != ActiveLB::NONE)
+      runtimeErrorMsg() << "Adaptive time steps are incompatible with LB";
+  }
+}
+
+/** Change the time step between two integration steps. The thermostat
+ *  prefactors depend on the time step and are updated immediately.
+ */
+static void update_time_step(double value) {
+  if (value != ::time_step) {
+    ::time_step = value;
+    thermo_init(::time_step);
+  }
+}
+
+/** Bit of the reduced step state that signals runtime errors. */
+static auto constexpr runtime_error_flag = 1u << 31u;
+
+/** @brief Reach consensus on the particle resort level and on the presence
+ *  of runtime errors in a single collective.
+ *  @return the global resort level and whether any rank has runtime errors
+ */
+static std::pair<unsigned, bool> reduce_resort_and_errors() {
+  auto local_state = cell_structure.get_resort_particles();
+  if (check_runtime_errors_local() > 0) {
+    local_state |= runtime_error_flag;
+  }
+  auto const global_state = boost::mpi::all_reduce(comm_cart, local_state,
+                                                   std::bit_or<unsigned>());
+  return {global_state & ~runtime_error_flag,
+          (global_state & runtime_error_flag) != 0u};
 }
 
 static void resort_particles_if_needed(ParticleRange const &particles) {
   auto const offset = LeesEdwards::verlet_list_offset(
       box_geo, cell_structure.get_le_pos_offset_at_last_resort());
   if (cell_structure.check_resort_required(particles, skin, offset)) {
-    cell_structure.set_resort_particles(Cells::RESORT_LOCAL);
+    cell_structure.set_resort_particles(Cells::RESORT_LOCAL,
+                                        Cells::REBUILD_DISPLACEMENT);
   }
 }
 
 /** @brief Calls the hook for propagation kernels before the force calculation
  *  @return whether or not to stop the integration loop early.
  */
-static bool integrator_step_1(ParticleRange const &particles) {
+static bool integrator_step_1(ParticleRange const &particles, double kT) {
   bool early_exit = false;
   switch (integ_switch) {
   case INTEG_METHOD_STEEPEST_DESCENT:
@@ -210,6 +257,9 @@ static bool integrator_step_1(ParticleRange const &particles) {
     stokesian_dynamics_step_1(particles, time_step);
     break;
 #endif // STOKESIAN_DYNAMICS
+  case INTEG_METHOD_BAOAB:
+    baoab_step_1(langevin, particles, time_step, kT);
+    break;
   default:
     throw std::runtime_error("Unknown value for integ_switch");
   }
@@ -240,6 +290,9 @@ static void integrator_step_2(ParticleRange const &particles, double kT) {
     // Nothing
     break;
 #endif // STOKESIAN_DYNAMICS
+  case INTEG_METHOD_BAOAB:
+    baoab_step_2(particles, time_step);
+    break;
   default:
     throw std::runtime_error("Unknown value for INTEG_SWITCH");
   }
@@ -299,18 +352,23 @@ int integrate(int n_steps, int reuse_forces) {
   // Integration loop
   ESPRESSO_PROFILER_CXX_MARK_LOOP_BEGIN(integration_loop, "Integration loop");
   int integrated_steps = 0;
+  auto const adaptive_time_step = get_adaptive_time_step();
   for (int step = 0; step < n_steps; step++) {
     ESPRESSO_PROFILER_CXX_MARK_LOOP_ITERATION(integration_loop, step);
 
     auto particles = cell_structure.local_particles();
 
+    if (adaptive_time_step) {
+      update_time_step(adaptive_time_step->propose(particles, time_step));
+    }
+
 #ifdef BOND_CONSTRAINT
     if (n_rigidbonds)
       save_old_position(particles, cell_structure.ghost_particles());
 #endif
 
     LeesEdwards::update_box_params();
-    bool early_exit = integrator_step_1(particles);
+    bool early_exit = integrator_step_1(particles, temperature);
     if (early_exit)
       break;
 
@@ -337,11 +395,16 @@ int integrate(int n_steps, int reuse_forces) {
     virtual_sites()->update();
 #endif
 
-    if (cell_structure.get_resort_particles() >= Cells::RESORT_LOCAL)
+    // The resort consensus also checks the runtime errors raised since the
+    // previous step, such that the loop needs a single collective per step
+    auto const [global_resort, runtime_errors] = reduce_resort_and_errors();
+    caught_error = runtime_errors;
+
+    if (global_resort >= Cells::RESORT_LOCAL)
       n_verlet_updates++;
 
     // Communication step: distribute ghost positions
-    cells_update_ghosts(global_ghost_flags());
+    cells_update_ghosts(global_ghost_flags(), global_resort);
 
     particles = cell_structure.local_particles();
 
@@ -383,10 +446,12 @@ int integrate(int n_steps, int reuse_forces) {
       BondBreakage::process_queue();
     }
 
+    on_integration_step();
+
     integrated_steps++;
 
-    if (check_runtime_errors(comm_cart)) {
-      caught_error = true;
+    // Errors raised after the resort consensus are caught in the next step
+    if (caught_error) {
       break;
     }
 
@@ -397,6 +462,10 @@ int integrate(int n_steps, int reuse_forces) {
     }
 
   } // for-loop over integration steps
+  // Catch the errors raised after the last resort consensus
+  if (not caught_error and check_runtime_errors(comm_cart)) {
+    caught_error = true;
+  }
   LeesEdwards::update_box_params();
   ESPRESSO_PROFILER_CXX_MARK_LOOP_END(integration_loop);
 
@@ -460,6 +529,9 @@ int integrate_with_signal_handler(int n_steps, int reuse_forces,
     ::set_skin(new_skin);
   }
 
+  /* adapt the cell system to the current particle density */
+  tune_cell_system_on_density_change();
+
   // re-acquire MpiCallbacks listener on worker nodes
   if (not is_head_node) {
     return 0;
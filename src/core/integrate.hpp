@@ -34,6 +34,7 @@
 #define INTEG_METHOD_STEEPEST_DESCENT 2
 #define INTEG_METHOD_BD 3
 #define INTEG_METHOD_SD 7
+#define INTEG_METHOD_BAOAB 8
 /**@}*/
 
 /** \name Integrator error codes */
@@ -82,6 +83,7 @@ void integrator_sanity_checks();
  *  - if reuse_forces is zero, recalculate the forces based on the current
  *    state of the system
  *  - Loop over the number of simulation steps:
+ *    -# adapt the time step, if an adaptive time step control is active
  *    -# initialization (e.g., RATTLE)
  *    -# First hook for propagation kernels
  *    -# Update dependent particles and properties (RATTLE, virtual sites)
@@ -94,6 +96,10 @@ void integrator_sanity_checks();
  *       detection, NpT update)
  *  - Final update of dependent properties and statistics/counters
  *
+ *  The runtime errors are checked in the same collective that decides
+ *  whether particles have to be resorted before the ghost update, such that
+ *  the integration stops at most one step after an error was raised.
+ *
  *  High-level documentation of the integration and thermostatting schemes
  *  can be found in doc/sphinx/system_setup.rst and /doc/sphinx/running.rst
  *
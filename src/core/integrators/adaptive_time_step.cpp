@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "integrators/adaptive_time_step.hpp"
+
+#include "Particle.hpp"
+#include "ParticleRange.hpp"
+#include "communication.hpp"
+
+#include <utils/math/sqr.hpp>
+
+#include <boost/mpi/collectives/all_reduce.hpp>
+#include <boost/mpi/operations.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+/** Currently active adaptive time step control */
+static std::shared_ptr<AdaptiveTimeStepParameters const> params;
+
+AdaptiveTimeStepParameters::AdaptiveTimeStepParameters(
+    double max_displacement, double time_step_min, double time_step_max,
+    double max_growth)
+    : max_displacement{max_displacement}, time_step_min{time_step_min},
+      time_step_max{time_step_max}, max_growth{max_growth} {
+  if (max_displacement <= 0.) {
+    throw std::domain_error("Parameter 'max_displacement' must be > 0");
+  }
+  if (time_step_min <= 0.) {
+    throw std::domain_error("Parameter 'time_step_min' must be > 0");
+  }
+  if (time_step_max < time_step_min) {
+    throw std::domain_error(
+        "Parameter 'time_step_max' must be >= 'time_step_min'");
+  }
+  if (max_growth < 1.) {
+    throw std::domain_error("Parameter 'max_growth' must be >= 1");
+  }
+}
+
+double AdaptiveTimeStepParameters::propose(ParticleRange const &particles,
+                                           double time_step) const {
+  auto dt_local = std::numeric_limits<double>::max();
+  for (auto const &p : particles) {
+    // virtual sites follow their real particles
+    if (p.is_virtual())
+      continue;
+    auto v2 = 0.;
+    auto a2 = 0.;
+    for (unsigned int j = 0; j < 3; j++) {
+      if (!p.is_fixed_along(j)) {
+        v2 += Utils::sqr(p.v()[j]);
+        a2 += Utils::sqr(p.force()[j] / p.mass());
+      }
+    }
+    // largest dt such that v dt + a dt^2 / 2 <= max_displacement
+    auto const v = std::sqrt(v2);
+    auto const a = std::sqrt(a2);
+    auto const denominator = v + std::sqrt(v2 + 2. * a * max_displacement);
+    if (denominator > 0.) {
+      dt_local = std::min(dt_local, 2. * max_displacement / denominator);
+    }
+  }
+  auto const dt = boost::mpi::all_reduce(comm_cart, dt_local,
+                                         boost::mpi::minimum<double>());
+  return std::clamp(std::min(dt, max_growth * time_step), time_step_min,
+                    time_step_max);
+}
+
+void register_adaptive_time_step(
+    std::shared_ptr<AdaptiveTimeStepParameters const> obj) {
+  ::params = std::move(obj);
+}
+
+std::shared_ptr<AdaptiveTimeStepParameters const> get_adaptive_time_step() {
+  return ::params;
+}
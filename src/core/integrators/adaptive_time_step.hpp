@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CORE_INTEGRATORS_ADAPTIVE_TIME_STEP_HPP
+#define CORE_INTEGRATORS_ADAPTIVE_TIME_STEP_HPP
+
+#include "ParticleRange.hpp"
+
+#include <memory>
+
+/** Parameters for the adaptive time step control */
+struct AdaptiveTimeStepParameters {
+  /** Maximal particle displacement
+   *
+   *  Maximal distance that a particle can travel during one integration step,
+   *  estimated from its velocity and acceleration.
+   */
+  double max_displacement;
+  /** Lower bound of the time step */
+  double time_step_min;
+  /** Upper bound of the time step */
+  double time_step_max;
+  /** Maximal relative increase of the time step between two steps */
+  double max_growth;
+
+  AdaptiveTimeStepParameters(double max_displacement, double time_step_min,
+                             double time_step_max, double max_growth);
+
+  /** Propose the time step of the next integration step.
+   *  The time step is reduced immediately when a particle would travel
+   *  further than @ref max_displacement, but it only increases by a factor
+   *  @ref max_growth per step, such that the thermostat prefactors change
+   *  smoothly. Collective call.
+   *  @param particles  Local particles
+   *  @param time_step  Time step of the previous integration step
+   */
+  double propose(ParticleRange const &particles, double time_step) const;
+};
+
+/** Set the adaptive time step control, or disable it with a null pointer. */
+void register_adaptive_time_step(
+    std::shared_ptr<AdaptiveTimeStepParameters const> obj);
+
+/** Currently active adaptive time step control, or a null pointer. */
+std::shared_ptr<AdaptiveTimeStepParameters const> get_adaptive_time_step();
+
+#endif /* CORE_INTEGRATORS_ADAPTIVE_TIME_STEP_HPP */
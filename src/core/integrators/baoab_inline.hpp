@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef INTEGRATORS_BAOAB_INLINE_HPP
+#define INTEGRATORS_BAOAB_INLINE_HPP
+
+#include "config/config.hpp"
+
+#include "Particle.hpp"
+#include "ParticleRange.hpp"
+#include "integrate.hpp"
+#include "integrators/velocity_verlet_inline.hpp"
+#include "rotation.hpp"
+#include "thermostat.hpp"
+#include "thermostats/langevin_inline.hpp"
+
+/** Integration steps before force calculation of the BAOAB Langevin
+ *  integrator @cite leimkuhler13a. The time step is split in a half kick
+ *  (B), a half drift (A), the exact solution of the Ornstein-Uhlenbeck
+ *  process of the velocities over a full step (O) and a second half drift:
+ *  <br> \f[ v \leftarrow v + 0.5 \Delta t f(t)/m \f]
+ *  <br> \f[ p \leftarrow p + 0.5 \Delta t v \f]
+ *  <br> \f[ v \leftarrow e^{-\gamma \Delta t/m} v
+ *           + \sqrt{k_B T/m (1 - e^{-2 \gamma \Delta t/m})} \, \xi \f]
+ *  <br> \f[ p(t + \Delta t) = p + 0.5 \Delta t v \f]
+ *  The final half kick (B) is the one of the Velocity Verlet integrator.
+ *  Rotational degrees of freedom are propagated like in the Velocity Verlet
+ *  integrator and thermalized by the Langevin torques.
+ */
+inline void baoab_step_1(LangevinThermostat const &langevin,
+                         ParticleRange const &particles, double time_step,
+                         double kT) {
+  auto const thermalized = (thermo_switch & THERMO_LANGEVIN) != 0;
+  for (auto &p : particles) {
+#ifdef ROTATION
+    propagate_omega_quat_particle(p, time_step);
+#endif
+
+    // Don't propagate translational degrees of freedom of vs
+    if (p.is_virtual())
+      continue;
+    for (unsigned int j = 0; j < 3; j++) {
+      if (!p.is_fixed_along(j)) {
+        p.v()[j] += 0.5 * time_step * p.force()[j] / p.mass();
+        p.pos()[j] += 0.5 * time_step * p.v()[j];
+      }
+    }
+    if (thermalized) {
+      auto const v = langevin_ou_velocity(langevin, p, time_step, kT);
+      for (unsigned int j = 0; j < 3; j++) {
+        if (!p.is_fixed_along(j)) {
+          p.v()[j] = v[j];
+        }
+      }
+    }
+    for (unsigned int j = 0; j < 3; j++) {
+      if (!p.is_fixed_along(j)) {
+        p.pos()[j] += 0.5 * time_step * p.v()[j];
+      }
+    }
+  }
+  increment_sim_time(time_step);
+}
+
+/** Final integration step of the BAOAB Langevin integrator */
+inline void baoab_step_2(ParticleRange const &particles, double time_step) {
+  velocity_verlet_step_2(particles, time_step);
+}
+
+#endif // INTEGRATORS_BAOAB_INLINE_HPP
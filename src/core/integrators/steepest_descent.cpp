@@ -93,7 +93,8 @@ bool steepest_descent_step(const ParticleRange &particles) {
     f_max = std::max(f_max, f);
   }
 
-  cell_structure.set_resort_particles(Cells::RESORT_LOCAL);
+  cell_structure.set_resort_particles(Cells::RESORT_LOCAL,
+                                      Cells::REBUILD_DISPLACEMENT);
 
   // Synchronize maximum force/torque encountered
   auto const f_max_global =
@@ -137,7 +137,8 @@ void velocity_verlet_npt_propagate_pos(const ParticleRange &particles,
     }
   }
 
-  cell_structure.set_resort_particles(Cells::RESORT_LOCAL);
+  cell_structure.set_resort_particles(Cells::RESORT_LOCAL,
+                                      Cells::REBUILD_BOX_CHANGE);
 
   /* Apply new volume to the box-length, communicate it, and account for
    * necessary adjustments to the cell geometry */
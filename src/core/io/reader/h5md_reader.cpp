@@ -0,0 +1,248 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "h5md_reader.hpp"
+
+#include "BondList.hpp"
+#include "Particle.hpp"
+#include "config/config.hpp"
+#include "lees_edwards/LeesEdwardsBC.hpp"
+
+#include <utils/Vector.hpp>
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Reader {
+namespace H5md {
+
+/**
+ * @brief Read a hyperslab of a dataset into a flat buffer.
+ * The read is independent, i.e. ranks with an empty hyperslab don't
+ * have to participate.
+ */
+template <typename T>
+static std::vector<T> read_hyperslab(h5xx::dataset &dataset, hid_t mem_type,
+                                     std::vector<hsize_t> const &offset,
+                                     std::vector<hsize_t> const &count) {
+  auto const n_elements = std::accumulate(count.begin(), count.end(),
+                                          hsize_t{1}, std::multiplies<>());
+  std::vector<T> buffer(n_elements);
+  if (n_elements == 0) {
+    return buffer;
+  }
+  auto const file_space = H5Dget_space(dataset.hid());
+  auto const mem_space =
+      H5Screate_simple(static_cast<int>(count.size()), count.data(), nullptr);
+  auto status = H5Sselect_hyperslab(file_space, H5S_SELECT_SET, offset.data(),
+                                    nullptr, count.data(), nullptr);
+  if (status >= 0) {
+    status = H5Dread(dataset.hid(), mem_type, mem_space, file_space,
+                     H5P_DEFAULT, buffer.data());
+  }
+  H5Sclose(mem_space);
+  H5Sclose(file_space);
+  if (status < 0) {
+    throw std::runtime_error("H5MD Error: cannot read dataset");
+  }
+  return buffer;
+}
+
+static auto get_extents(h5xx::dataset &dataset) {
+  return static_cast<h5xx::dataspace>(dataset).extents();
+}
+
+File::File(std::string file_path, boost::mpi::communicator comm)
+    : m_file_path(std::move(file_path)), m_comm(std::move(comm)) {
+  m_h5md_file = h5xx::file(m_file_path, m_comm, MPI_INFO_NULL, h5xx::file::in);
+  if (not has_dataset("particles/atoms/id/value") or
+      not has_dataset("particles/atoms/position/value")) {
+    throw std::runtime_error("The given .h5 file doesn't contain particle ids "
+                             "and positions.");
+  }
+}
+
+bool File::has_dataset(std::string const &path) {
+  return h5xx::exists_dataset(m_h5md_file, path);
+}
+
+int File::n_frames() {
+  auto dataset = h5xx::dataset(m_h5md_file, "particles/atoms/id/value");
+  return static_cast<int>(get_extents(dataset)[0]);
+}
+
+int File::frame_index(int frame) {
+  auto const n = n_frames();
+  auto const index = (frame < 0) ? n + frame : frame;
+  if (index < 0 or index >= n) {
+    throw std::out_of_range("Frame " + std::to_string(frame) +
+                            " doesn't exist, the file contains " +
+                            std::to_string(n) + " frames");
+  }
+  return index;
+}
+
+Frame File::read_frame(int frame, int bond_id) {
+  auto const index = static_cast<hsize_t>(frame_index(frame));
+  Frame out{};
+
+  {
+    auto dataset = h5xx::dataset(m_h5md_file, "particles/atoms/id/time");
+    out.time = read_hyperslab<double>(dataset, H5T_NATIVE_DOUBLE, {index},
+                                      {1})[0];
+  }
+  {
+    auto dataset = h5xx::dataset(m_h5md_file, "particles/atoms/id/step");
+    out.step = read_hyperslab<int>(dataset, H5T_NATIVE_INT, {index}, {1})[0];
+  }
+  if (has_dataset("particles/atoms/box/edges/value")) {
+    auto dataset =
+        h5xx::dataset(m_h5md_file, "particles/atoms/box/edges/value");
+    auto const edges =
+        read_hyperslab<double>(dataset, H5T_NATIVE_DOUBLE, {index, 0}, {1, 3});
+    out.box_l = Utils::Vector3d(edges.begin(), edges.end());
+  }
+  auto const le_path = std::string("particles/atoms/lees_edwards/");
+  if (has_dataset(le_path + "offset/value") and
+      has_dataset(le_path + "direction/value") and
+      has_dataset(le_path + "normal/value")) {
+    auto ds_offset = h5xx::dataset(m_h5md_file, le_path + "offset/value");
+    auto ds_direction = h5xx::dataset(m_h5md_file, le_path + "direction/value");
+    auto ds_normal = h5xx::dataset(m_h5md_file, le_path + "normal/value");
+    LeesEdwardsBC lebc{};
+    lebc.pos_offset = read_hyperslab<double>(ds_offset, H5T_NATIVE_DOUBLE,
+                                             {index, 0}, {1, 1})[0];
+    lebc.shear_direction = read_hyperslab<int>(ds_direction, H5T_NATIVE_INT,
+                                               {index, 0}, {1, 1})[0];
+    lebc.shear_plane_normal =
+        read_hyperslab<int>(ds_normal, H5T_NATIVE_INT, {index, 0}, {1, 1})[0];
+    out.lees_edwards_bc = lebc;
+  }
+
+  /* split the particle dimension in contiguous slices */
+  auto ds_id = h5xx::dataset(m_h5md_file, "particles/atoms/id/value");
+  auto const n_part_max = get_extents(ds_id)[1];
+  auto const n_ranks = static_cast<hsize_t>(m_comm.size());
+  auto const rank = static_cast<hsize_t>(m_comm.rank());
+  auto const offset =
+      rank * (n_part_max / n_ranks) + std::min(rank, n_part_max % n_ranks);
+  auto const count =
+      n_part_max / n_ranks + ((rank < n_part_max % n_ranks) ? 1u : 0u);
+
+  /* entries of particles that didn't exist in this frame hold the fill
+   * value of the dataset, which is negative */
+  auto const ids =
+      read_hyperslab<int>(ds_id, H5T_NATIVE_INT, {index, offset}, {1, count});
+  std::vector<std::size_t> slots;
+  for (std::size_t i = 0; i < ids.size(); ++i) {
+    if (ids[i] >= 0) {
+      slots.emplace_back(i);
+    }
+  }
+  auto &particles = out.particles;
+  particles.resize(slots.size());
+  for (std::size_t i = 0; i < slots.size(); ++i) {
+    particles[i].id() = ids[slots[i]];
+  }
+
+  auto const read_scalar = [&](std::string const &name, hid_t mem_type,
+                               auto value_type, auto &&op) {
+    auto const path = "particles/atoms/" + name + "/value";
+    if (not has_dataset(path)) {
+      return;
+    }
+    auto dataset = h5xx::dataset(m_h5md_file, path);
+    auto const values = read_hyperslab<decltype(value_type)>(
+        dataset, mem_type, {index, offset}, {1, count});
+    for (std::size_t i = 0; i < slots.size(); ++i) {
+      op(particles[i], values[slots[i]]);
+    }
+  };
+  auto const read_vector = [&](std::string const &name, hid_t mem_type,
+                               auto value_type, auto &&op) {
+    using value_t = decltype(value_type);
+    auto const path = "particles/atoms/" + name + "/value";
+    if (not has_dataset(path)) {
+      return;
+    }
+    auto dataset = h5xx::dataset(m_h5md_file, path);
+    auto const values = read_hyperslab<value_t>(dataset, mem_type,
+                                                {index, offset, 0},
+                                                {1, count, 3});
+    for (std::size_t i = 0; i < slots.size(); ++i) {
+      auto const it = values.begin() + static_cast<long>(3 * slots[i]);
+      op(particles[i], Utils::Vector<value_t, 3>(it, it + 3));
+    }
+  };
+
+  read_vector("position", H5T_NATIVE_DOUBLE, double{},
+              [](Particle &p, Utils::Vector3d const &v) { p.pos() = v; });
+  read_vector("image", H5T_NATIVE_INT, int{},
+              [](Particle &p, Utils::Vector3i const &v) { p.image_box() = v; });
+  read_vector("velocity", H5T_NATIVE_DOUBLE, double{},
+              [](Particle &p, Utils::Vector3d const &v) { p.v() = v; });
+  read_scalar("species", H5T_NATIVE_INT, int{},
+              [](Particle &p, int value) { p.type() = value; });
+#ifdef MASS
+  read_scalar("mass", H5T_NATIVE_DOUBLE, double{},
+              [](Particle &p, double value) { p.mass() = value; });
+#endif
+#ifdef ELECTROSTATICS
+  read_scalar("charge", H5T_NATIVE_DOUBLE, double{},
+              [](Particle &p, double value) { p.q() = value; });
+#endif
+
+  if (bond_id >= 0 and has_dataset("connectivity/atoms/value")) {
+    /* The bonds are stored with the particle that owns them, which can be
+     * in the slice of any rank. The connectivity table only contains two
+     * integers per bond, hence each rank reads it in full and keeps the
+     * bonds of its particles. */
+    std::unordered_map<int, std::size_t> local_index;
+    for (std::size_t i = 0; i < particles.size(); ++i) {
+      local_index[particles[i].id()] = i;
+    }
+    auto dataset = h5xx::dataset(m_h5md_file, "connectivity/atoms/value");
+    auto const n_bonds = get_extents(dataset)[1];
+    auto const bonds = read_hyperslab<int>(dataset, H5T_NATIVE_INT,
+                                           {index, 0, 0}, {1, n_bonds, 2});
+    for (std::size_t i = 0; i < n_bonds; ++i) {
+      auto const p_id = bonds[2 * i];
+      auto const partner_id = bonds[2 * i + 1];
+      auto const it = local_index.find(p_id);
+      if (p_id < 0 or partner_id < 0 or it == local_index.end()) {
+        continue;
+      }
+      particles[it->second].bonds().insert({bond_id, {&partner_id, 1}});
+    }
+  }
+
+  return out;
+}
+
+} /* namespace H5md */
+} /* namespace Reader */
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CORE_IO_READER_H5MD_READER_HPP
+#define CORE_IO_READER_H5MD_READER_HPP
+
+/** @file
+ *  Parallel reader for H5MD files written by @ref Writer::H5md::File.
+ *
+ *  Each MPI rank reads a contiguous hyperslab of the particle datasets
+ *  of the requested frame. The particles are then routed to the ranks
+ *  that own their positions by @ref make_new_particles.
+ *
+ *  Implementation in h5md_reader.cpp.
+ */
+
+#include "Particle.hpp"
+#include "lees_edwards/LeesEdwardsBC.hpp"
+
+#include <utils/Vector.hpp>
+
+#include <boost/mpi/communicator.hpp>
+#include <boost/optional.hpp>
+
+#include <h5xx/h5xx.hpp>
+
+#include <string>
+#include <vector>
+
+namespace Reader {
+namespace H5md {
+
+/** @brief Content of a trajectory frame. */
+struct Frame {
+  double time;
+  int step;
+  /** Box length, if it was written to the file. */
+  boost::optional<Utils::Vector3d> box_l;
+  /** Lees-Edwards state, if it was written to the file. */
+  boost::optional<LeesEdwardsBC> lees_edwards_bc;
+  /** Particles of the hyperslab read by this rank. */
+  std::vector<Particle> particles;
+};
+
+/**
+ * @brief Class for reading H5MD files.
+ */
+class File {
+public:
+  /**
+   * @brief Open an H5MD file in read-only mode. Collective call.
+   * @param file_path Path to the hdf5 file on disk.
+   * @param comm The MPI communicator.
+   */
+  File(std::string file_path,
+       boost::mpi::communicator comm = boost::mpi::communicator());
+
+  /**
+   * @brief Retrieve the path to the hdf5 file.
+   * @return The path as a string.
+   */
+  auto const &file_path() const { return m_file_path; }
+
+  /**
+   * @brief Number of frames stored in the file.
+   */
+  int n_frames();
+
+  /**
+   * @brief Read a frame. Collective call.
+   * Each rank reads a contiguous slice of the particles of the frame.
+   * The positions, velocities, species, masses, charges and images are
+   * restored when present in the file. The connectivity table doesn't
+   * store the bond types; pair bonds are only restored when a bond id
+   * is provided, otherwise they are ignored.
+   * @param frame Index of the frame, negative values count from the end.
+   * @param bond_id Bond type of the connectivity table, or -1.
+   */
+  Frame read_frame(int frame, int bond_id);
+
+private:
+  bool has_dataset(std::string const &path);
+  int frame_index(int frame);
+
+  std::string m_file_path;
+  boost::mpi::communicator m_comm;
+  h5xx::file m_h5md_file;
+};
+
+} /* namespace H5md */
+} /* namespace Reader */
+#endif
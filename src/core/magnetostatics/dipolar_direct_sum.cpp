@@ -42,9 +42,13 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
+#include <functional>
 #include <iterator>
+#include <numeric>
 #include <stdexcept>
 #include <tuple>
 #include <utility>
@@ -104,6 +108,93 @@ auto pair_potential(Utils::Vector3d const &d, Utils::Vector3d const &m1,
   return pe1 / r3 - 3.0 * pe2 * pe3 / r5;
 }
 
+using ImageTensors = DipolarDirectSum::ImageTensors;
+
+/** @brief Index of the components of the symmetric rank-2 tensor. */
+constexpr std::array<std::array<int, 3>, 3> tensor2_index = {
+    {{{0, 1, 2}}, {{1, 3, 4}}, {{2, 4, 5}}}};
+
+/** @brief Index of the components of the symmetric rank-3 tensor. */
+constexpr std::array<std::array<std::array<int, 3>, 3>, 3> tensor3_index = {
+    {{{{{6, 7, 8}}, {{7, 9, 10}}, {{8, 10, 11}}}},
+     {{{{7, 9, 10}}, {{9, 12, 13}}, {{10, 13, 14}}}},
+     {{{{8, 10, 11}}, {{10, 13, 14}}, {{11, 14, 15}}}}}};
+
+/**
+ * @brief Dipolar interaction tensors of two dipoles.
+ *
+ * The interaction energy of the dipoles @f$ \vec{m}_1 @f$ and
+ * @f$ \vec{m}_2 @f$ is @f$ m_{1,a} T_{ab} m_{2,b} @f$ with
+ * @f$ T_{ab} = -\partial_a \partial_b r^{-1} @f$, and the force on
+ * the first dipole is @f$ m_{1,a} m_{2,b} G_{abc} @f$ with
+ * @f$ G_{abc} = \partial_a \partial_b \partial_c r^{-1} @f$.
+ *
+ * @param d Distance vector.
+ *
+ * @return Independent components of @f$ T @f$ and @f$ G @f$.
+ */
+auto dipolar_tensors(Utils::Vector3d const &d) {
+  auto const r2 = d.norm2();
+  auto const r = std::sqrt(r2);
+  auto const r3 = r2 * r;
+  auto const r5 = r3 * r2;
+  auto const r7 = r5 * r2;
+
+  ImageTensors t{};
+  for (int a = 0; a < 3; ++a) {
+    for (int b = a; b < 3; ++b) {
+      auto const delta_ab = static_cast<double>(a == b);
+      t[tensor2_index[a][b]] = delta_ab / r3 - 3. * d[a] * d[b] / r5;
+      for (int c = b; c < 3; ++c) {
+        auto const delta_ac = static_cast<double>(a == c);
+        auto const delta_bc = static_cast<double>(b == c);
+        t[tensor3_index[a][b][c]] =
+            3. * (delta_ab * d[c] + delta_ac * d[b] + delta_bc * d[a]) / r5 -
+            15. * d[a] * d[b] * d[c] / r7;
+      }
+    }
+  }
+  return t;
+}
+
+/** @brief Contract the rank-2 tensor with a dipole moment. */
+auto tensor_product(ImageTensors const &t, Utils::Vector3d const &m) {
+  Utils::Vector3d tm{};
+  for (int a = 0; a < 3; ++a) {
+    for (int b = 0; b < 3; ++b) {
+      tm[a] += t[tensor2_index[a][b]] * m[b];
+    }
+  }
+  return tm;
+}
+
+/**
+ * @brief Pair force of two interacting dipoles from the interaction
+ * tensors, cf. @ref pair_force.
+ */
+auto tensor_pair_force(ImageTensors const &t, Utils::Vector3d const &m1,
+                       Utils::Vector3d const &m2) {
+  Utils::Vector3d f{};
+  for (int a = 0; a < 3; ++a) {
+    for (int b = 0; b < 3; ++b) {
+      for (int c = 0; c < 3; ++c) {
+        f[c] += m1[a] * m2[b] * t[tensor3_index[a][b][c]];
+      }
+    }
+  }
+  auto const torque = -vector_product(m1, tensor_product(t, m2));
+  return ParticleForce{f, torque};
+}
+
+/**
+ * @brief Pair potential of two interacting dipoles from the interaction
+ * tensors, cf. @ref pair_potential.
+ */
+auto tensor_pair_potential(ImageTensors const &t, Utils::Vector3d const &m1,
+                           Utils::Vector3d const &m2) {
+  return m1 * tensor_product(t, m2);
+}
+
 /**
  * @brief Call kernel for every 3d index in a sphere around the origin.
  *
@@ -197,6 +288,31 @@ T image_sum(InputIterator begin, InputIterator end, InputIterator it,
   return init;
 }
 
+/**
+ * @brief Sum over all pairs with the tabulated periodic images.
+ *
+ * Counterpart of @ref image_sum for the tabulated lattice sum, which
+ * is a function of the minimum image distance. The self-interaction
+ * with the periodic images is included.
+ *
+ * @param begin Iterator pointing to begin of particle range
+ * @param end Iterator pointing past the end of particle range
+ * @param it Pointer to particle that is considered
+ * @param init Initial value of the sum.
+ * @param f Binary operation mapping distance and moment of the
+ *          interaction partner to the value to be summed up for this pair.
+ *
+ * @return The total sum.
+ */
+template <class InputIterator, class T, class F>
+T table_sum(InputIterator begin, InputIterator end, InputIterator it, T init,
+            F f) {
+  for (auto jt = begin; jt != end; ++jt) {
+    init += f(::box_geo.get_mi_vector(it->pos, jt->pos), jt->m);
+  }
+  return init;
+}
+
 auto gather_particle_data(ParticleRange const &particles, int n_replicas) {
   auto const &comm = ::comm_cart;
   std::vector<Particle *> local_particles;
@@ -265,6 +381,10 @@ auto get_n_cut(int n_replicas) {
  * Logically this is equivalent to the potential calculation
  * in @ref DipolarDirectSum::long_range_energy, which calculates
  * a naive N-square sum, but has better performance and scaling.
+ *
+ * With a tabulated lattice sum, only the minimum image is summed
+ * explicitly, and the interaction with the periodic replicas is
+ * interpolated from the table.
  */
 void DipolarDirectSum::add_long_range_forces(
     ParticleRange const &particles) const {
@@ -273,7 +393,8 @@ void DipolarDirectSum::add_long_range_forces(
       gather_particle_data(particles, n_replicas);
 
   /* Number of image boxes considered */
-  auto const ncut = get_n_cut(n_replicas);
+  auto const tabulated = not m_table.empty();
+  auto const ncut = (tabulated) ? Utils::Vector3i{} : get_n_cut(n_replicas);
   auto const with_replicas = (ncut.norm2() > 0);
 
   /* Range of particles we calculate the ia for on this node */
@@ -281,6 +402,13 @@ void DipolarDirectSum::add_long_range_forces(
   auto const local_posmom_end =
       local_posmom_begin + static_cast<long>(local_particles.size());
 
+  /* Force kernel for the tabulated images */
+  auto const table_force = [this](auto const &it) {
+    return [this, it](Utils::Vector3d const &d, Utils::Vector3d const &mj) {
+      return tensor_pair_force(image_tensors(d), it->m, mj);
+    };
+  };
+
   /* Output iterator for the force */
   auto p = local_particles.begin();
 
@@ -292,6 +420,9 @@ void DipolarDirectSum::add_long_range_forces(
         [it](Utils::Vector3d const &rn, Utils::Vector3d const &mj) {
           return pair_force(rn, it->m, mj);
         });
+    if (tabulated) {
+      fi = table_sum(it, std::next(it), it, fi, table_force(it));
+    }
 
     /* IA with other local particles */
     auto q = std::next(p);
@@ -312,6 +443,13 @@ void DipolarDirectSum::add_long_range_forces(
          * 0 = t_i + r_ij x F_ij + t_j */
         fji.torque += vector_product(pf.f, rn) - pf.torque;
       });
+      if (tabulated) {
+        auto const t = image_tensors(d);
+        auto const pf = tensor_pair_force(t, it->m, jt->m);
+        fij += pf;
+        fji.f -= pf.f;
+        fji.torque -= vector_product(jt->m, tensor_product(t, it->m));
+      }
 
       fi += fij;
       (*q)->force() += prefactor * fji.f;
@@ -345,6 +483,13 @@ void DipolarDirectSum::add_long_range_forces(
                       return pair_force(rn, it->m, mj);
                     });
 
+    if (tabulated) {
+      fi = table_sum(all_posmom.begin(), local_posmom_begin, it, fi,
+                     table_force(it));
+      fi = table_sum(local_posmom_end, all_posmom.end(), it, fi,
+                     table_force(it));
+    }
+
     (*p)->force() += prefactor * fi.f;
     (*p)->torque() += prefactor * fi.torque;
   }
@@ -362,7 +507,8 @@ DipolarDirectSum::long_range_energy(ParticleRange const &particles) const {
       gather_particle_data(particles, n_replicas);
 
   /* Number of image boxes considered */
-  auto const ncut = get_n_cut(n_replicas);
+  auto const tabulated = not m_table.empty();
+  auto const ncut = (tabulated) ? Utils::Vector3i{} : get_n_cut(n_replicas);
   auto const with_replicas = (ncut.norm2() > 0);
 
   /* Wait for the rest of the data to arrive */
@@ -379,19 +525,122 @@ DipolarDirectSum::long_range_energy(ParticleRange const &particles) const {
                   [it](Utils::Vector3d const &rn, Utils::Vector3d const &mj) {
                     return pair_potential(rn, it->m, mj);
                   });
+    if (tabulated) {
+      u = table_sum(it, all_posmom.end(), it, u,
+                    [this, it](Utils::Vector3d const &d,
+                               Utils::Vector3d const &mj) {
+                      return tensor_pair_potential(image_tensors(d), it->m, mj);
+                    });
+    }
   }
 
   return prefactor * u;
 }
 
-DipolarDirectSum::DipolarDirectSum(double prefactor, int n_replicas)
-    : prefactor{prefactor}, n_replicas{n_replicas} {
+/**
+ * @brief Tabulate the lattice sum of the periodic images.
+ *
+ * The sum of the interaction tensors over the periodic images within
+ * a sphere of radius @ref n_replicas around the minimum image is
+ * evaluated on the nodes of a regular grid spanning the minimum image
+ * separations. The minimum image itself is excluded from the sum, so
+ * that the tabulated function is smooth. The table is only recomputed
+ * when the box length changes.
+ */
+void DipolarDirectSum::init() {
+  if (n_table == 0) {
+    return;
+  }
+  sanity_checks();
+  auto const &box_l = ::box_geo.length();
+  if (not m_table.empty() and m_table_box_l == box_l) {
+    return;
+  }
+
+  auto const ncut = get_n_cut(n_replicas);
+  auto const n_nodes = static_cast<std::size_t>(n_table) + 1u;
+  auto const grid_spacing = box_l / static_cast<double>(n_table);
+  m_table.assign(n_nodes * n_nodes * n_nodes, ImageTensors{});
+  auto node = m_table.begin();
+  for (std::size_t i = 0u; i < n_nodes; ++i) {
+    for (std::size_t j = 0u; j < n_nodes; ++j) {
+      for (std::size_t k = 0u; k < n_nodes; ++k, ++node) {
+        auto const d =
+            Utils::hadamard_product(
+                Utils::Vector3d{static_cast<double>(i), static_cast<double>(j),
+                                static_cast<double>(k)},
+                grid_spacing) -
+            0.5 * box_l;
+        for_each_image(ncut, [&](int nx, int ny, int nz) {
+          if (nx != 0 or ny != 0 or nz != 0) {
+            auto const rn = d + Utils::Vector3d{nx * box_l[0], ny * box_l[1],
+                                                nz * box_l[2]};
+            auto const t = dipolar_tensors(rn);
+            std::transform(node->begin(), node->end(), t.begin(),
+                           node->begin(), std::plus<>());
+          }
+        });
+      }
+    }
+  }
+  m_table_box_l = box_l;
+}
+
+/** @brief Trilinear interpolation of the tabulated lattice sum. */
+auto DipolarDirectSum::image_tensors(Utils::Vector3d const &d) const
+    -> ImageTensors {
+  auto const n_nodes = n_table + 1;
+  std::array<int, 3> index{};
+  std::array<double, 3> weight{};
+  for (unsigned int i = 0u; i < 3u; ++i) {
+    auto const u = (d[i] / m_table_box_l[i] + 0.5) * n_table;
+    index[i] = std::clamp(static_cast<int>(std::floor(u)), 0, n_table - 1);
+    weight[i] = u - static_cast<double>(index[i]);
+  }
+
+  ImageTensors result{};
+  for (int dx = 0; dx < 2; ++dx) {
+    for (int dy = 0; dy < 2; ++dy) {
+      for (int dz = 0; dz < 2; ++dz) {
+        auto const w = (dx ? weight[0] : 1. - weight[0]) *
+                       (dy ? weight[1] : 1. - weight[1]) *
+                       (dz ? weight[2] : 1. - weight[2]);
+        auto const &node =
+            m_table[static_cast<std::size_t>(
+                ((index[0] + dx) * n_nodes + index[1] + dy) * n_nodes +
+                index[2] + dz)];
+        for (std::size_t c = 0u; c < result.size(); ++c) {
+          result[c] += w * node[c];
+        }
+      }
+    }
+  }
+  return result;
+}
+
+void DipolarDirectSum::sanity_checks() const {
+  if (n_table > 0 and (!::box_geo.periodic(0) or !::box_geo.periodic(1) or
+                       !::box_geo.periodic(2))) {
+    throw std::runtime_error(
+        "DipolarDirectSum: tabulation requires periodicity (True, True, True)");
+  }
+}
+
+DipolarDirectSum::DipolarDirectSum(double prefactor, int n_replicas,
+                                   int n_table)
+    : prefactor{prefactor}, n_replicas{n_replicas}, n_table{n_table} {
   if (prefactor <= 0.) {
     throw std::domain_error("Parameter 'prefactor' must be > 0");
   }
   if (n_replicas < 0) {
     throw std::domain_error("Parameter 'n_replicas' must be >= 0");
   }
+  if (n_table < 0) {
+    throw std::domain_error("Parameter 'n_table' must be >= 0");
+  }
+  if (n_table > 0 and n_replicas == 0) {
+    throw std::domain_error("Parameter 'n_table' requires 'n_replicas' > 0");
+  }
 }
 
 #endif // DIPOLES
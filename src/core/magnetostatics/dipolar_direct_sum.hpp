@@ -28,27 +28,58 @@
 
 #include "ParticleRange.hpp"
 
+#include <utils/Vector.hpp>
+
+#include <array>
+#include <vector>
+
 /**
  * @brief Dipolar all with all and no replica.
  * Handling of a system of dipoles where no replicas exist.
  * Assumes minimum image convention for those axis in which the
  * system is periodic.
+ *
+ * When @ref n_table is non-zero, the interaction with the periodic
+ * replicas is not summed explicitly. Instead, the sum of the dipolar
+ * interaction tensors over the replicas is tabulated on a grid of
+ * minimum image separations at setup, and interpolated for each pair.
  */
 struct DipolarDirectSum {
+  /** @brief Independent components of the dipolar interaction tensor
+   *  (6 components) and of its gradient (10 components).
+   */
+  using ImageTensors = std::array<double, 16>;
+
   double prefactor;
   int n_replicas;
-  DipolarDirectSum(double prefactor, int n_replicas);
+  /** @brief Number of grid cells per direction of the tabulated lattice
+   *  sum, or 0 to sum over the periodic replicas explicitly.
+   */
+  int n_table;
+  DipolarDirectSum(double prefactor, int n_replicas, int n_table = 0);
 
-  void on_activation() const {}
-  void on_boxl_change() const {}
+  void on_activation() { init(); }
+  void on_boxl_change() { init(); }
   void on_node_grid_change() const {}
-  void on_periodicity_change() const {}
+  void on_periodicity_change() { init(); }
   void on_cell_structure_change() const {}
-  void init() const {}
-  void sanity_checks() const {}
+  void init();
+  void sanity_checks() const;
 
   double long_range_energy(ParticleRange const &particles) const;
   void add_long_range_forces(ParticleRange const &particles) const;
+
+private:
+  /**
+   * @brief Interpolate the tabulated lattice sum.
+   * @param d Minimum image distance vector.
+   */
+  ImageTensors image_tensors(Utils::Vector3d const &d) const;
+
+  /** @brief Lattice sum on the nodes of the tabulation grid. */
+  std::vector<ImageTensors> m_table;
+  /** @brief Box length of the tabulation grid. */
+  Utils::Vector3d m_table_box_l;
 };
 
 #endif // DIPOLES
@@ -40,6 +40,7 @@
 #include <boost/optional.hpp>
 
 #include <cassert>
+#include <cstddef>
 #include <cstdio>
 #include <stdexcept>
 
@@ -98,6 +99,15 @@ double cutoff() {
   return -1.;
 }
 
+std::size_t memory_usage() {
+#ifdef DP3M
+  if (auto dp3m = get_actor_by_type<DipolarP3M>(magnetostatics_actor)) {
+    return dp3m->dp3m.memory_usage();
+  }
+#endif
+  return 0u;
+}
+
 void on_observable_calc() {
 #ifdef DP3M
   if (auto dp3m = get_actor_by_type<DipolarP3M>(magnetostatics_actor)) {
@@ -106,6 +116,18 @@ void on_observable_calc() {
 #endif
 }
 
+void on_integration_step() {
+#ifdef DP3M
+  if (auto dp3m = get_actor_by_type<DipolarP3M>(magnetostatics_actor)) {
+    try {
+      dp3m->on_integration_step();
+    } catch (std::runtime_error const &err) {
+      runtimeErrorMsg() << err.what();
+    }
+  }
+#endif
+}
+
 struct LongRangeForce : public boost::static_visitor<void> {
   ParticleRange const &m_particles;
   explicit LongRangeForce(ParticleRange const &particles)
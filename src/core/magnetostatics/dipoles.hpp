@@ -95,7 +95,11 @@ void calc_pressure_long_range();
 void sanity_checks();
 double cutoff();
 
+/** @brief Heap memory of the long-range solver, in bytes. */
+std::size_t memory_usage();
+
 void on_observable_calc();
+void on_integration_step();
 void on_dipoles_change();
 void on_boxl_change();
 void on_node_grid_change();
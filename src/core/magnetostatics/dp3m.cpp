@@ -127,7 +127,9 @@ void DipolarP3M::init() {
 
   int ca_mesh_size = fft_init(dp3m.local_mesh.dim, dp3m.local_mesh.margin,
                               dp3m.params.mesh, dp3m.params.mesh_off,
-                              dp3m.ks_pnum, dp3m.fft, node_grid, comm_cart);
+                              dp3m.ks_pnum, dp3m.fft, node_grid, comm_cart,
+                              dp3m.params.tuning, dp3m.params.kspace_ranks,
+                              dp3m.params.fft_decomposition);
   dp3m.rs_mesh.resize(ca_mesh_size);
   dp3m.ks_mesh.resize(ca_mesh_size);
 
@@ -144,9 +146,14 @@ void DipolarP3M::init() {
 }
 
 DipolarP3M::DipolarP3M(P3MParameters &&parameters, double prefactor,
-                       int tune_timings, bool tune_verbose)
+                       int tune_timings, bool tune_verbose,
+                       std::string fftw_wisdom_file, int retune_interval,
+                       double retune_tolerance)
     : dp3m{std::move(parameters)}, prefactor{prefactor},
-      tune_timings{tune_timings}, tune_verbose{tune_verbose} {
+      tune_timings{tune_timings}, tune_verbose{tune_verbose},
+      fftw_wisdom_file{std::move(fftw_wisdom_file)},
+      retune_interval{retune_interval}, retune_tolerance{retune_tolerance},
+      m_target_accuracy{dp3m.params.accuracy} {
 
   m_is_tuned = !dp3m.params.tuning;
   dp3m.params.tuning = false;
@@ -157,6 +164,12 @@ DipolarP3M::DipolarP3M(P3MParameters &&parameters, double prefactor,
   if (tune_timings <= 0) {
     throw std::domain_error("Parameter 'timings' must be > 0");
   }
+  if (retune_interval < 0) {
+    throw std::domain_error("Parameter 'retune_interval' must be >= 0");
+  }
+  if (retune_tolerance <= 1.) {
+    throw std::domain_error("Parameter 'retune_tolerance' must be > 1");
+  }
 
   if (dp3m.params.mesh != Utils::Vector3i::broadcast(dp3m.params.mesh[0])) {
     throw std::domain_error("DipolarP3M requires a cubic mesh");
@@ -267,9 +280,7 @@ double DipolarP3M::kernel(bool force_flag, bool energy_flag,
     dp3m.sm.gather_grid(Utils::make_span(meshes), comm_cart,
                         dp3m.local_mesh.dim);
 
-    fft_perform_forw(dp3m.rs_mesh_dip[0].data(), dp3m.fft, comm_cart);
-    fft_perform_forw(dp3m.rs_mesh_dip[1].data(), dp3m.fft, comm_cart);
-    fft_perform_forw(dp3m.rs_mesh_dip[2].data(), dp3m.fft, comm_cart);
+    fft_perform_forw(Utils::make_span(meshes), dp3m.fft, comm_cart);
     // Note: after these calls, the grids are in the order yzx and not xyz
     // anymore!!!
   }
@@ -470,17 +481,12 @@ double DipolarP3M::kernel(bool force_flag, bool energy_flag,
           }
         }
         /* Back FFT force component mesh */
-        fft_perform_back(dp3m.rs_mesh_dip[0].data(), false, dp3m.fft,
-                         comm_cart);
-        fft_perform_back(dp3m.rs_mesh_dip[1].data(), false, dp3m.fft,
-                         comm_cart);
-        fft_perform_back(dp3m.rs_mesh_dip[2].data(), false, dp3m.fft,
-                         comm_cart);
-        /* redistribute force component mesh */
         std::array<double *, 3> meshes = {{dp3m.rs_mesh_dip[0].data(),
                                            dp3m.rs_mesh_dip[1].data(),
                                            dp3m.rs_mesh_dip[2].data()}};
-
+        fft_perform_back(Utils::make_span(meshes), false, dp3m.fft,
+                         comm_cart);
+        /* redistribute force component mesh */
         dp3m.sm.spread_grid(Utils::make_span(meshes), comm_cart,
                             dp3m.local_mesh.dim);
         /* Assign force component from mesh to particle */
@@ -643,6 +649,18 @@ public:
     return {Utils::Vector2d{rs_err, ks_err}.norm(), rs_err, ks_err, alpha_L};
   }
 
+  std::tuple<double, double, double>
+  calculate_error(Utils::Vector3i const &mesh, int cao, double r_cut_iL,
+                  double alpha_L) const override {
+    auto const rs_err =
+        dp3m_real_space_error(box_geo.length()[0], r_cut_iL,
+                              dp3m.sum_dip_part, dp3m.sum_mu2, alpha_L);
+    auto const ks_err = dp3m_k_space_error(box_geo.length()[0], mesh[0], cao,
+                                           dp3m.sum_dip_part, dp3m.sum_mu2,
+                                           alpha_L);
+    return {Utils::Vector2d{rs_err, ks_err}.norm(), rs_err, ks_err};
+  }
+
   void determine_mesh_limits() override {
     if (dp3m.params.mesh[0] == -1) {
       /* simple heuristic to limit the tried meshes if the accuracy cannot
@@ -701,6 +719,9 @@ void DipolarP3M::tune() {
   if (dp3m.params.r_cut_iL == 0. and dp3m.params.r_cut != 0.) {
     dp3m.params.r_cut_iL = dp3m.params.r_cut * box_geo.length_inv()[0];
   }
+  if (not fftw_wisdom_file.empty()) {
+    fft_import_wisdom(fftw_wisdom_file, comm_cart);
+  }
   if (not is_tuned()) {
     count_magnetic_particles();
     if (dp3m.sum_dip_part == 0) {
@@ -724,6 +745,26 @@ void DipolarP3M::tune() {
     }
   }
   init();
+  if (not fftw_wisdom_file.empty()) {
+    fft_export_wisdom(fftw_wisdom_file, comm_cart);
+  }
+}
+
+void DipolarP3M::on_integration_step() {
+  if (retune_interval == 0 or dp3m.params.tuning or
+      ++m_steps_since_check < retune_interval) {
+    return;
+  }
+  m_steps_since_check = 0;
+  count_magnetic_particles();
+  if (dp3m.sum_dip_part == 0) {
+    return;
+  }
+  DipolarTuningAlgorithm parameters(dp3m, prefactor, tune_timings);
+  parameters.setup_logger(false);
+  if (parameters.adapt(m_target_accuracy, retune_tolerance)) {
+    on_dipoles_change();
+  }
 }
 
 /** Calculate the k-space error of dipolar-P3M */
@@ -908,6 +949,11 @@ void DipolarP3M::sanity_checks_node_grid() const {
     throw std::runtime_error(
         "DipolarP3M: node grid must be sorted, largest first");
   }
+  if (dp3m.params.kspace_ranks > 0 and
+      n_nodes % dp3m.params.kspace_ranks != 0) {
+    throw std::runtime_error("DipolarP3M: parameter 'kspace_ranks' must be "
+                             "a divisor of the number of MPI ranks");
+  }
 }
 
 void DipolarP3M::scaleby_box_l() {
@@ -44,6 +44,7 @@
 
 #include "Particle.hpp"
 #include "ParticleRange.hpp"
+#include "memory_usage.hpp"
 
 #include <utils/Vector.hpp>
 #include <utils/constants.hpp>
@@ -51,6 +52,8 @@
 
 #include <array>
 #include <cmath>
+#include <cstddef>
+#include <string>
 #include <vector>
 
 #ifdef NPT
@@ -88,6 +91,17 @@ struct dp3m_data_struct : public p3m_data_struct_base {
   double energy_correction = 0.;
 
   fft_data_struct fft;
+
+  /** Heap memory of the meshes and of the communication buffers, in bytes. */
+  std::size_t memory_usage() const {
+    return p3m_data_struct_base::memory_usage() +
+           MemoryUsage::heap_size(rs_mesh) +
+           MemoryUsage::heap_size(rs_mesh_dip[0]) +
+           MemoryUsage::heap_size(rs_mesh_dip[1]) +
+           MemoryUsage::heap_size(rs_mesh_dip[2]) +
+           MemoryUsage::heap_size(ks_mesh) + inter_weights.memory_usage() +
+           sm.memory_usage() + fft.memory_usage();
+  }
 };
 
 /** @brief Dipolar P3M solver. */
@@ -99,9 +113,17 @@ struct DipolarP3M {
   double prefactor;
   int tune_timings;
   bool tune_verbose;
+  /** File to read FFTW wisdom from and write it to; empty to disable. */
+  std::string fftw_wisdom_file;
+  /** Number of integration steps between two accuracy checks; 0 to
+   *  disable the accuracy monitoring. */
+  int retune_interval;
+  /** Tolerated ratio between the error estimate and the target accuracy. */
+  double retune_tolerance;
 
   DipolarP3M(P3MParameters &&parameters, double prefactor, int tune_timings,
-             bool tune_verbose);
+             bool tune_verbose, std::string fftw_wisdom_file,
+             int retune_interval, double retune_tolerance);
 
   void on_activation() {
     sanity_checks();
@@ -169,6 +191,16 @@ struct DipolarP3M {
   void tune();
   bool is_tuned() const { return m_is_tuned; }
 
+  /**
+   * @brief Monitor the accuracy during an integration.
+   *
+   * Every @ref retune_interval integration steps, the error estimate is
+   * re-evaluated with the current dipoles and box, and the parameters are
+   * adapted when it drifted away from the target accuracy by more than
+   * @ref retune_tolerance (see @ref CoulombP3M::on_integration_step).
+   */
+  void on_integration_step();
+
   /** Compute the k-space part of forces and energies. */
   double kernel(bool force_flag, bool energy_flag,
                 ParticleRange const &particles);
@@ -272,6 +304,10 @@ struct DipolarP3M {
 
 private:
   bool m_is_tuned;
+  /** Target accuracy of the accuracy monitoring. */
+  double m_target_accuracy;
+  /** Number of integration steps since the last accuracy check. */
+  int m_steps_since_check = 0;
 
   /** Calculate self-energy in k-space. */
   double calc_average_self_energy_k_space() const;
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "memory_usage.hpp"
+
+#include "config/config.hpp"
+
+#include "accumulators.hpp"
+#include "cells.hpp"
+#include "communication.hpp"
+#include "electrostatics/coulomb.hpp"
+#include "grid_based_algorithms/lb.hpp"
+#include "magnetostatics/dipoles.hpp"
+#include "particle_node.hpp"
+
+#include <boost/mpi/collectives/reduce.hpp>
+#include <boost/mpi/operations.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace MemoryUsage {
+
+std::vector<std::pair<std::string, std::size_t>> local_memory_usage() {
+#ifdef ELECTROSTATICS
+  auto const p3m = Coulomb::memory_usage();
+#else
+  auto const p3m = std::size_t{0u};
+#endif
+#ifdef DIPOLES
+  auto const dp3m = Dipoles::memory_usage();
+#else
+  auto const dp3m = std::size_t{0u};
+#endif
+  return {
+      {"local_particles", cell_structure.memory_usage_local_particles()},
+      {"ghost_particles", cell_structure.memory_usage_ghost_particles()},
+      {"pair_lists", cell_structure.memory_usage_pair_lists()},
+      {"particle_index", cell_structure.memory_usage_particle_index() +
+                             particle_node_memory_usage()},
+      {"type_map", type_map_memory_usage()},
+      {"lb_fluid", lb_memory_usage()},
+      {"p3m", p3m},
+      {"dp3m", dp3m},
+      {"fetch_cache", fetch_cache_memory_usage()},
+      {"accumulators", Accumulators::auto_update_memory_usage()},
+  };
+}
+
+std::vector<Entry> memory_usage() {
+  auto local = local_memory_usage();
+  auto const total = std::accumulate(
+      local.begin(), local.end(), std::size_t{0u},
+      [](std::size_t bytes, auto const &kv) { return bytes + kv.second; });
+  local.emplace_back("total", total);
+
+  auto const n = static_cast<int>(local.size());
+  std::vector<std::size_t> values;
+  for (auto const &kv : local) {
+    values.emplace_back(kv.second);
+  }
+  std::vector<std::size_t> min(local.size());
+  std::vector<std::size_t> max(local.size());
+  std::vector<std::size_t> sum(local.size());
+  boost::mpi::reduce(comm_cart, values.data(), n, min.data(),
+                     boost::mpi::minimum<std::size_t>(), 0);
+  boost::mpi::reduce(comm_cart, values.data(), n, max.data(),
+                     boost::mpi::maximum<std::size_t>(), 0);
+  boost::mpi::reduce(comm_cart, values.data(), n, sum.data(),
+                     std::plus<std::size_t>(), 0);
+
+  std::vector<Entry> entries;
+  for (std::size_t i = 0; i < local.size(); ++i) {
+    entries.push_back({local[i].first, min[i], max[i], sum[i]});
+  }
+  return entries;
+}
+
+} // namespace MemoryUsage
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ESPRESSO_SRC_CORE_MEMORY_USAGE_HPP
+#define ESPRESSO_SRC_CORE_MEMORY_USAGE_HPP
+
+/** @file
+ *  Accounting of the heap memory held by the simulation subsystems.
+ *
+ *  The memory usage is derived from the capacity of the containers
+ *  which store the data of each subsystem. The bookkeeping overhead
+ *  of the memory allocator is not included, and the size of the nodes
+ *  of hash tables is estimated.
+ */
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace MemoryUsage {
+
+/** @brief Heap memory held by a contiguous container, in bytes. */
+template <class Container> std::size_t heap_size(Container const &c) {
+  return c.capacity() * sizeof(typename Container::value_type);
+}
+
+/** @brief Heap memory held by a hash table of elements of type @p T,
+ *  in bytes. Each node is assumed to store the element, a pointer to
+ *  the next node and the cached hash value.
+ */
+template <class T>
+std::size_t hash_table_heap_size(std::size_t size, std::size_t bucket_count) {
+  return size * (sizeof(T) + 2u * sizeof(void *)) +
+         bucket_count * sizeof(void *);
+}
+
+/** @brief Heap memory held by a hash table, in bytes. */
+template <class Container>
+std::size_t hash_table_heap_size(Container const &c) {
+  return hash_table_heap_size<typename Container::value_type>(
+      c.size(), c.bucket_count());
+}
+
+/** @brief Memory usage of a subsystem, aggregated over all MPI ranks. */
+struct Entry {
+  std::string name;
+  std::size_t min;
+  std::size_t max;
+  std::size_t sum;
+};
+
+/** @brief Memory usage of the subsystems on this MPI rank, in bytes. */
+std::vector<std::pair<std::string, std::size_t>> local_memory_usage();
+
+/**
+ * @brief Memory usage of the subsystems, aggregated over all MPI ranks.
+ *
+ * The last entry is the total of all subsystems. Collective call, the
+ * result is only valid on the head node.
+ */
+std::vector<Entry> memory_usage();
+
+} // namespace MemoryUsage
+
+#endif
@@ -43,6 +43,10 @@ template <typename CutoffGetter = GetNonbondedCutoff> class VerletCriterion {
   const double m_eff_coulomb_cut2 = 0.;
   const double m_eff_dipolar_cut2 = 0.;
   const double m_collision_cut2 = 0.;
+  const double m_max_cut;
+  const double m_coulomb_cut;
+  const double m_dipolar_cut;
+  const double m_collision_cut;
   double eff_cutoff_sqr(double x) const {
     if (x == INACTIVE_CUTOFF)
       return INACTIVE_CUTOFF;
@@ -57,7 +61,20 @@ public:
       : m_skin(skin), m_eff_max_cut2(eff_cutoff_sqr(max_cut)),
         m_eff_coulomb_cut2(eff_cutoff_sqr(coulomb_cut)),
         m_eff_dipolar_cut2(eff_cutoff_sqr(dipolar_cut)),
-        m_collision_cut2(eff_cutoff_sqr(collision_detection_cutoff)) {}
+        m_collision_cut2(eff_cutoff_sqr(collision_detection_cutoff)),
+        m_max_cut(max_cut), m_coulomb_cut(coulomb_cut),
+        m_dipolar_cut(dipolar_cut),
+        m_collision_cut(collision_detection_cutoff) {}
+
+  /** Same criterion with a different skin, e.g. for the pruning of a
+   *  Verlet list built with a larger skin.
+   */
+  VerletCriterion with_skin(double skin) const {
+    auto criterion = VerletCriterion{skin, m_max_cut, m_coulomb_cut,
+                                     m_dipolar_cut, m_collision_cut};
+    criterion.get_nonbonded_cutoff = get_nonbonded_cutoff;
+    return criterion;
+  }
 
   template <typename Distance>
   bool operator()(const Particle &p1, const Particle &p2,
@@ -37,15 +37,20 @@
 #include <utils/math/int_pow.hpp>
 #include <utils/math/sqr.hpp>
 
-/** Calculate Lennard-Jones force factor */
-inline double lj_pair_force_factor(IA_parameters const &ia_params,
-                                   double dist) {
-  if (dist < ia_params.lj.max_cutoff() and dist > ia_params.lj.min_cutoff()) {
-    auto const r_off = dist - ia_params.lj.offset;
-    auto const frac6 = Utils::int_pow<6>(ia_params.lj.sig / r_off);
-    return 48.0 * ia_params.lj.eps * frac6 * (frac6 - 0.5) / (r_off * dist);
+/** Calculate Lennard-Jones force factor.
+ *  @tparam T  Floating-point type used for the evaluation.
+ */
+template <typename T>
+T lj_pair_force_factor(IA_parameters const &ia_params, T dist) {
+  if (dist < static_cast<T>(ia_params.lj.max_cutoff()) and
+      dist > static_cast<T>(ia_params.lj.min_cutoff())) {
+    auto const r_off = dist - static_cast<T>(ia_params.lj.offset);
+    auto const frac6 =
+        Utils::int_pow<6>(static_cast<T>(ia_params.lj.sig) / r_off);
+    return T(48.0) * static_cast<T>(ia_params.lj.eps) * frac6 *
+           (frac6 - T(0.5)) / (r_off * dist);
   }
-  return 0.0;
+  return T(0.0);
 }
 
 /** Calculate Lennard-Jones energy */
@@ -35,14 +35,18 @@
 #include <utils/math/int_pow.hpp>
 #include <utils/math/sqr.hpp>
 
-/** Calculate WCA force factor */
-inline double wca_pair_force_factor(IA_parameters const &ia_params,
-                                    double dist) {
-  if (dist < ia_params.wca.cut) {
-    auto const frac6 = Utils::int_pow<6>(ia_params.wca.sig / dist);
-    return 48.0 * ia_params.wca.eps * frac6 * (frac6 - 0.5) / (dist * dist);
+/** Calculate WCA force factor.
+ *  @tparam T  Floating-point type used for the evaluation.
+ */
+template <typename T>
+T wca_pair_force_factor(IA_parameters const &ia_params, T dist) {
+  if (dist < static_cast<T>(ia_params.wca.cut)) {
+    auto const frac6 =
+        Utils::int_pow<6>(static_cast<T>(ia_params.wca.sig) / dist);
+    return T(48.0) * static_cast<T>(ia_params.wca.eps) * frac6 *
+           (frac6 - T(0.5)) / (dist * dist);
   }
-  return 0.0;
+  return T(0.0);
 }
 
 /** Calculate WCA energy */
@@ -32,11 +32,13 @@
 #include "grid.hpp"
 #include "integrate.hpp"
 
+#include <boost/range/algorithm/max_element.hpp>
 #include <boost/range/algorithm/min_element.hpp>
 
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <stdexcept>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -54,6 +56,9 @@ static auto constexpr P3M_TUNE_ACCURACY_TOO_LARGE = 3.;
 /** @brief Precision threshold for a non-zero real-space cutoff. */
 static auto constexpr P3M_RCUT_PREC = 1e-3;
 
+/** @brief Largest number of mesh points per direction when adapting. */
+static auto constexpr P3M_ADAPT_MESH_MAX = 512;
+
 void TuningAlgorithm::determine_r_cut_limits() {
   auto const r_cut_iL = get_params().r_cut_iL;
   if (r_cut_iL == 0.) {
@@ -93,6 +98,86 @@ void TuningAlgorithm::commit(Utils::Vector3i const &mesh, int cao,
   p3m_params.mesh = mesh;
 }
 
+void TuningAlgorithm::tune_kspace_ranks(Parameters &tuned_params) {
+  auto &params = get_params();
+  commit(tuned_params.mesh, tuned_params.cao, tuned_params.r_cut_iL,
+         tuned_params.alpha_L);
+  auto best_kspace_ranks = 0;
+  m_logger->log_kspace_ranks(comm_cart.size(), tuned_params.time);
+  for (auto n = comm_cart.size(); n % 2 == 0;) {
+    n /= 2;
+    params.kspace_ranks = n;
+    on_solver_change();
+    auto const time = benchmark_integration_step(m_timings);
+    m_logger->log_kspace_ranks(n, time);
+    if (time < tuned_params.time) {
+      tuned_params.time = time;
+      best_kspace_ranks = n;
+    }
+  }
+  params.kspace_ranks = best_kspace_ranks;
+}
+
+bool TuningAlgorithm::adapt(double target_accuracy, double tolerance) {
+  auto &params = get_params();
+  double error, rs_err, ks_err, alpha_L;
+  std::tie(error, rs_err, ks_err) = calculate_error(
+      params.mesh, params.cao, params.r_cut_iL, params.alpha_L);
+  if (error <= tolerance * target_accuracy and
+      error * tolerance >= target_accuracy) {
+    return false;
+  }
+
+  params.accuracy = target_accuracy;
+  auto const cao = params.cao;
+  auto const min_box_l = *boost::min_element(box_geo.length());
+  auto const min_local_box_l = *boost::min_element(local_geo.length());
+  auto const k_cut_max = std::min(min_box_l, min_local_box_l) - skin;
+  auto r_cut_iL_min = 0.;
+  auto r_cut_iL_max = (std::min(min_local_box_l, min_box_l / 2.) - skin) *
+                      box_geo.length_inv()[0];
+
+  /* refine the mesh until the largest real-space cutoff is accurate enough */
+  auto mesh = params.mesh;
+  for (;;) {
+    auto const k_cut_per_dir = (static_cast<double>(cao) / 2.) *
+                               Utils::hadamard_division(box_geo.length(), mesh);
+    if (cao >= *boost::min_element(mesh) or
+        *boost::min_element(k_cut_per_dir) >= k_cut_max or
+        *boost::max_element(mesh) > P3M_ADAPT_MESH_MAX) {
+      throw std::runtime_error(m_logger->get_name() +
+                               ": failed to reach requested accuracy");
+    }
+    std::tie(error, rs_err, ks_err, alpha_L) =
+        calculate_accuracy(mesh, cao, r_cut_iL_max);
+    if (error <= target_accuracy) {
+      break;
+    }
+    auto const scale = static_cast<double>(mesh[0] + 2) / mesh[0];
+    for (auto &n_points : mesh) {
+      n_points = static_cast<int>(std::round(scale * n_points));
+      n_points += n_points % 2;
+    }
+  }
+
+  /* bisection of the real-space cutoff */
+  while (r_cut_iL_max - r_cut_iL_min >= P3M_RCUT_PREC) {
+    auto const r_cut_iL = 0.5 * (r_cut_iL_min + r_cut_iL_max);
+    std::tie(error, rs_err, ks_err, alpha_L) =
+        calculate_accuracy(mesh, cao, r_cut_iL);
+    if (error > target_accuracy)
+      r_cut_iL_min = r_cut_iL;
+    else
+      r_cut_iL_max = r_cut_iL;
+  }
+  std::tie(error, rs_err, ks_err, alpha_L) =
+      calculate_accuracy(mesh, cao, r_cut_iL_max);
+
+  params.accuracy = error;
+  commit(mesh, cao, r_cut_iL_max, alpha_L);
+  return true;
+}
+
 /**
  * @brief Get the optimal alpha and the corresponding computation time
  * for a fixed @p mesh and @p cao.
@@ -135,6 +135,18 @@ public:
   calculate_accuracy(Utils::Vector3i const &mesh, int cao,
                      double r_cut_iL) const = 0;
 
+  /**
+   * @brief Get the error for this combination of parameters.
+   * @param[in]     mesh       @copybrief P3MParameters::mesh
+   * @param[in]     cao        @copybrief P3MParameters::cao
+   * @param[in]     r_cut_iL   @copybrief P3MParameters::r_cut_iL
+   * @param[in]     alpha_L    @copybrief P3MParameters::alpha_L
+   * @returns Error magnitude, real-space error, k-space error
+   */
+  virtual std::tuple<double, double, double>
+  calculate_error(Utils::Vector3i const &mesh, int cao, double r_cut_iL,
+                  double alpha_L) const = 0;
+
   /** @brief Veto real-space cutoffs larger than the layer correction gap. */
   virtual boost::optional<std::string>
   layer_correction_veto_r_cut(double r_cut) const = 0;
@@ -147,7 +159,11 @@ public:
     // activate tuning mode
     get_params().tuning = true;
 
-    auto const tuned_params = get_time();
+    auto tuned_params = get_time();
+    if (tuned_params.time != time_sentinel and
+        get_params().kspace_ranks == -1) {
+      tune_kspace_ranks(tuned_params);
+    }
 
     // deactivate tuning mode
     get_params().tuning = false;
@@ -166,7 +182,34 @@ public:
                              tuned_params.accuracy, tuned_params.time);
   }
 
+  /**
+   * @brief Adapt the parameters to the current state of the system.
+   *
+   * Unlike @ref tune, no timings are measured, which allows calling this
+   * function during an integration. When the error estimate of the current
+   * parameters is larger than the target accuracy by more than a factor
+   * @p tolerance, or smaller by more than that factor, the real-space
+   * cutoff and Ewald splitting parameter are determined again by bisection
+   * for the current mesh and cao. When the target accuracy cannot be
+   * reached with the largest possible real-space cutoff, the mesh is
+   * refined. The mesh is never coarsened.
+   *
+   * @param[in] target_accuracy  Target accuracy
+   * @param[in] tolerance        Tolerated ratio between the error estimate
+   *                             and the target accuracy
+   * @returns Whether the parameters were changed
+   */
+  bool adapt(double target_accuracy, double tolerance);
+
 protected:
+  /**
+   * @brief Find the fastest number of MPI ranks performing the FFT.
+   * Fewer ranks shrink the FFT all-to-all communication, at the cost of
+   * more k-space work per rank. Starting from all ranks, the number of
+   * ranks is halved as long as it divides the number of ranks.
+   * @param[in,out] tuned_params  Tuned parameters, the time is updated.
+   */
+  void tune_kspace_ranks(Parameters &tuned_params);
   auto get_n_trials() { return m_n_trials; }
   void increment_n_trials() { ++m_n_trials; }
   void reset_n_trials() { m_n_trials = 0ul; }
@@ -66,6 +66,12 @@ public:
     }
   }
 
+  void log_kspace_ranks(int kspace_ranks, double time) const {
+    if (m_verbose) {
+      std::printf("kspace_ranks %-4d %-8.2f\n", kspace_ranks, time);
+    }
+  }
+
   void tuning_goals(double accuracy, double prefactor, double box_l,
                     int n_particles, double sum_prop) const {
     if (m_verbose) {
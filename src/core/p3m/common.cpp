@@ -33,6 +33,34 @@
 
 #include <cmath>
 #include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace {
+std::pair<FFTDecomposition, char const *> const fft_decomposition_names[] = {
+    {FFTDecomposition::AUTO, "auto"},
+    {FFTDecomposition::SLAB, "slab"},
+    {FFTDecomposition::PENCIL, "pencil"}};
+} // namespace
+
+FFTDecomposition fft_decomposition_from_name(std::string const &name) {
+  for (auto const &kv : fft_decomposition_names) {
+    if (kv.second == name) {
+      return kv.first;
+    }
+  }
+  throw std::domain_error("Parameter 'fft_decomposition' must be one of "
+                          "'auto', 'slab', 'pencil'");
+}
+
+std::string fft_decomposition_name(FFTDecomposition decomposition) {
+  for (auto const &kv : fft_decomposition_names) {
+    if (kv.first == decomposition) {
+      return kv.second;
+    }
+  }
+  throw std::logic_error("Invalid FFT decomposition");
+}
 
 double p3m_analytic_cotangent_sum(int n, double mesh_i, int cao) {
   auto const c =
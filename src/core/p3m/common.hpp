@@ -51,6 +51,7 @@ auto constexpr P3M_EPSILON_METALLIC = 0.0;
 
 #include <array>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 namespace detail {
@@ -64,6 +65,22 @@ enum FFT_WAVE_VECTOR : int { KY = 0, KZ = 1, KX = 2 };
 } // namespace FFT_indexing
 } // namespace detail
 
+/** Decomposition of the k-space mesh onto the nodes performing the FFT. */
+enum class FFTDecomposition : int {
+  /** choose from the mesh size and the number of FFT nodes */
+  AUTO,
+  /** planes, one transpose between FFT nodes per 3D-FFT */
+  SLAB,
+  /** rows, two transposes between FFT nodes per 3D-FFT */
+  PENCIL
+};
+
+/** Get the @ref FFTDecomposition with the given name. */
+FFTDecomposition fft_decomposition_from_name(std::string const &name);
+
+/** Get the name of a @ref FFTDecomposition. */
+std::string fft_decomposition_name(FFTDecomposition decomposition);
+
 /** Structure to hold P3M parameters and some dependent variables. */
 struct P3MParameters {
   /** tuning or production? */
@@ -101,13 +118,19 @@ struct P3MParameters {
   /** number of points unto which a single charge is interpolated, i.e.
    *  @ref P3MParameters::cao "cao" cubed */
   int cao3;
+  /** number of MPI ranks performing the FFT (0 for all ranks). */
+  int kspace_ranks;
+  /** decomposition of the k-space mesh onto the FFT ranks. */
+  FFTDecomposition fft_decomposition;
 
   P3MParameters(bool tuning, double epsilon, double r_cut,
                 Utils::Vector3i const &mesh, Utils::Vector3d const &mesh_off,
-                int cao, double alpha, double accuracy)
+                int cao, double alpha, double accuracy, int kspace_ranks,
+                FFTDecomposition fft_decomposition)
       : tuning{tuning}, alpha_L{0.}, r_cut_iL{0.}, mesh{mesh},
         mesh_off{mesh_off}, cao{cao}, accuracy{accuracy}, epsilon{epsilon},
-        cao_cut{}, a{}, ai{}, alpha{alpha}, r_cut{r_cut}, cao3{-1} {
+        cao_cut{}, a{}, ai{}, alpha{alpha}, r_cut{r_cut}, cao3{-1},
+        kspace_ranks{kspace_ranks}, fft_decomposition{fft_decomposition} {
 
     auto constexpr value_to_tune = -1.;
 
@@ -157,6 +180,10 @@ struct P3MParameters {
     if (not tuning and (Utils::Vector3i::broadcast(cao) > mesh)) {
       throw std::domain_error("Parameter 'cao' cannot be larger than 'mesh'");
     }
+
+    if (kspace_ranks < 0 and (not tuning or kspace_ranks != -1)) {
+      throw std::domain_error("Parameter 'kspace_ranks' must be >= 0");
+    }
   }
 
   /**
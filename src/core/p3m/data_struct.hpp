@@ -26,8 +26,10 @@
 #if defined(P3M) || defined(DP3M)
 
 #include "common.hpp"
+#include "memory_usage.hpp"
 
 #include <array>
+#include <cstddef>
 #include <vector>
 
 struct p3m_data_struct_base {
@@ -47,6 +49,15 @@ struct p3m_data_struct_base {
   /** number of permutations in k_space */
   int ks_pnum;
 
+  /** Heap memory of the differential operator and of the influence
+   *  functions, in bytes.
+   */
+  std::size_t memory_usage() const {
+    return MemoryUsage::heap_size(d_op[0]) + MemoryUsage::heap_size(d_op[1]) +
+           MemoryUsage::heap_size(d_op[2]) + MemoryUsage::heap_size(g_force) +
+           MemoryUsage::heap_size(g_energy);
+  }
+
   /** Calculate the Fourier transformed differential operator.
    *  Remark: This is done on the level of n-vectors and not k-vectors,
    *  i.e. the prefactor @f$ 2i\pi/L @f$ is missing!
@@ -36,16 +36,26 @@
 #include <utils/index.hpp>
 #include <utils/math/permute_ifield.hpp>
 
+#include <boost/mpi/collectives/broadcast.hpp>
+#include <boost/mpi/collectives/gather.hpp>
 #include <boost/none.hpp>
 #include <boost/optional.hpp>
+#include <boost/serialization/string.hpp>
 
 #include <fftw3.h>
 #include <mpi.h>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdio>
 #include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
 #include <stdexcept>
+#include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -232,7 +242,7 @@ int calc_local_mesh(const int *n_pos, const int *n_grid, const int *mesh,
  *  \param[in]  mesh     global mesh dimensions.
  *  \param[in]  mesh_off global mesh offset (see \ref p3m_data_struct).
  *  \param[out] block    send block specification.
- *  \return Size of the send block.
+ *  \return Size of the send block, zero if the local meshes don't overlap.
  */
 int calc_send_block(const int *pos1, const int *grid1, const int *pos2,
                     const int *grid2, const int *mesh, const double *mesh_off,
@@ -248,7 +258,8 @@ int calc_send_block(const int *pos1, const int *grid1, const int *pos2,
     last1[i] = first1[i] + mesh1[i] - 1;
     last2[i] = first2[i] + mesh2[i] - 1;
     block[i] = std::max(first1[i], first2[i]) - first1[i];
-    block[i + 3] = (std::min(last1[i], last2[i]) - first1[i]) - block[i] + 1;
+    block[i + 3] = std::max(
+        0, (std::min(last1[i], last2[i]) - first1[i]) - block[i] + 1);
     size *= block[i + 3];
   }
   return size;
@@ -352,65 +363,89 @@ void pack_block_permute2(double const *const in, double *const out,
 }
 
 /** Communicate the grid data according to the given forward FFT plan.
+ *  The blocks of all meshes are packed into a single message per
+ *  communication step.
  *  \param plan   FFT communication plan.
- *  \param in     input mesh.
- *  \param out    output mesh.
+ *  \param in     input meshes.
+ *  \param out    output meshes, one per input mesh.
  *  \param fft    FFT communication plan.
  *  \param comm   MPI communicator.
  */
-void forw_grid_comm(fft_forw_plan plan, const double *in, double *out,
-                    fft_data_struct &fft,
+void forw_grid_comm(fft_forw_plan const &plan, Utils::Span<double *const> in,
+                    Utils::Span<double *const> out, fft_data_struct &fft,
                     const boost::mpi::communicator &comm) {
+  auto const n_meshes = static_cast<int>(in.size());
   for (int i = 0; i < plan.group.size(); i++) {
-    plan.pack_function(in, fft.send_buf.data(), &(plan.send_block[6 * i]),
-                       &(plan.send_block[6 * i + 3]), plan.old_mesh,
-                       plan.element);
+    for (int k = 0; k < n_meshes; k++) {
+      plan.pack_function(in[k], fft.send_buf.data() + k * plan.send_size[i],
+                         &(plan.send_block[6 * i]),
+                         &(plan.send_block[6 * i + 3]), plan.old_mesh,
+                         plan.element);
+    }
 
-    if (plan.group[i] != comm.rank()) {
-      MPI_Sendrecv(fft.send_buf.data(), plan.send_size[i], MPI_DOUBLE,
-                   plan.group[i], REQ_FFT_FORW, fft.recv_buf.data(),
-                   plan.recv_size[i], MPI_DOUBLE, plan.group[i], REQ_FFT_FORW,
-                   comm, MPI_STATUS_IGNORE);
+    if (plan.group[i] != comm.rank() or plan.recv_group[i] != comm.rank()) {
+      MPI_Sendrecv(fft.send_buf.data(), n_meshes * plan.send_size[i],
+                   MPI_DOUBLE, plan.group[i], REQ_FFT_FORW,
+                   fft.recv_buf.data(), n_meshes * plan.recv_size[i],
+                   MPI_DOUBLE, plan.recv_group[i], REQ_FFT_FORW, comm,
+                   MPI_STATUS_IGNORE);
     } else { /* Self communication... */
       std::swap(fft.send_buf, fft.recv_buf);
     }
-    fft_unpack_block(fft.recv_buf.data(), out, &(plan.recv_block[6 * i]),
-                     &(plan.recv_block[6 * i + 3]), plan.new_mesh,
-                     plan.element);
+    for (int k = 0; k < n_meshes; k++) {
+      fft_unpack_block(fft.recv_buf.data() + k * plan.recv_size[i], out[k],
+                       &(plan.recv_block[6 * i]),
+                       &(plan.recv_block[6 * i + 3]), plan.new_mesh,
+                       plan.element);
+    }
   }
 }
 
 /** Communicate the grid data according to the given backward FFT plan.
+ *  The blocks of all meshes are packed into a single message per
+ *  communication step.
  *  \param plan_f Forward FFT plan.
  *  \param plan_b Backward FFT plan.
- *  \param in     input mesh.
- *  \param out    output mesh.
+ *  \param in     input meshes.
+ *  \param out    output meshes, one per input mesh.
  *  \param fft    FFT communication plan.
  *  \param comm   MPI communicator.
  */
-void back_grid_comm(fft_forw_plan plan_f, fft_back_plan plan_b,
-                    const double *in, double *out, fft_data_struct &fft,
+void back_grid_comm(fft_forw_plan const &plan_f, fft_back_plan const &plan_b,
+                    Utils::Span<double *const> in,
+                    Utils::Span<double *const> out, fft_data_struct &fft,
                     const boost::mpi::communicator &comm) {
   /* Back means: Use the send/receive stuff from the forward plan but
      replace the receive blocks by the send blocks and vice
      versa. Attention then also new_mesh and old_mesh are exchanged */
 
+  auto const n_meshes = static_cast<int>(in.size());
   for (int i = 0; i < plan_f.group.size(); i++) {
-    plan_b.pack_function(in, fft.send_buf.data(), &(plan_f.recv_block[6 * i]),
-                         &(plan_f.recv_block[6 * i + 3]), plan_f.new_mesh,
-                         plan_f.element);
-
-    if (plan_f.group[i] != comm.rank()) { /* send first, receive second */
-      MPI_Sendrecv(fft.send_buf.data(), plan_f.recv_size[i], MPI_DOUBLE,
-                   plan_f.group[i], REQ_FFT_BACK, fft.recv_buf.data(),
-                   plan_f.send_size[i], MPI_DOUBLE, plan_f.group[i],
-                   REQ_FFT_BACK, comm, MPI_STATUS_IGNORE);
+    for (int k = 0; k < n_meshes; k++) {
+      plan_b.pack_function(in[k],
+                           fft.send_buf.data() + k * plan_f.recv_size[i],
+                           &(plan_f.recv_block[6 * i]),
+                           &(plan_f.recv_block[6 * i + 3]), plan_f.new_mesh,
+                           plan_f.element);
+    }
+
+    /* send to the node we received from in the forward direction */
+    if (plan_f.group[i] != comm.rank() or
+        plan_f.recv_group[i] != comm.rank()) {
+      MPI_Sendrecv(fft.send_buf.data(), n_meshes * plan_f.recv_size[i],
+                   MPI_DOUBLE, plan_f.recv_group[i], REQ_FFT_BACK,
+                   fft.recv_buf.data(), n_meshes * plan_f.send_size[i],
+                   MPI_DOUBLE, plan_f.group[i], REQ_FFT_BACK, comm,
+                   MPI_STATUS_IGNORE);
     } else { /* Self communication... */
       std::swap(fft.send_buf, fft.recv_buf);
     }
-    fft_unpack_block(fft.recv_buf.data(), out, &(plan_f.send_block[6 * i]),
-                     &(plan_f.send_block[6 * i + 3]), plan_f.old_mesh,
-                     plan_f.element);
+    for (int k = 0; k < n_meshes; k++) {
+      fft_unpack_block(fft.recv_buf.data() + k * plan_f.send_size[i], out[k],
+                       &(plan_f.send_block[6 * i]),
+                       &(plan_f.send_block[6 * i + 3]), plan_f.old_mesh,
+                       plan_f.element);
+    }
   }
 }
 
@@ -478,13 +513,109 @@ void calc_2d_grid(int n, int grid[3]) {
     }
   }
 }
+
+/** Decide whether to decompose the mesh into slabs instead of pencils.
+ *  Slabs need one transpose between FFT nodes less per 3D-FFT, but the
+ *  number of FFT nodes is limited by the number of mesh planes. In
+ *  automatic mode, slabs are used as long as each node gets at least
+ *  two planes along every direction.
+ */
+bool use_slab_decomposition(FFTDecomposition decomposition,
+                            Utils::Vector3i const &global_mesh_dim,
+                            int n_fft_nodes) {
+  if (decomposition == FFTDecomposition::AUTO) {
+    auto const min_mesh_dim = *std::min_element(global_mesh_dim.begin(),
+                                                global_mesh_dim.end());
+    return min_mesh_dim >= 2 * n_fft_nodes;
+  }
+  return decomposition == FFTDecomposition::SLAB;
+}
+
+/** Find the communication steps for a change from the node grid @p grid1
+ *  to the node grid @p grid2, where @p grid2 may only span a subset of the
+ *  nodes. At step @c d, each node sends to the node @c d ranks above and
+ *  receives from the node @c d ranks below, which pairs up the messages of
+ *  all nodes without deadlock. Steps without data in either direction are
+ *  skipped, a missing partner is replaced by @c MPI_PROC_NULL.
+ *
+ *  \param[in]  grid1    The node grid you start with.
+ *  \param[in]  pos1     Positions of the nodes in @p grid1.
+ *  \param[in]  grid2    The node grid you want to have.
+ *  \param[in]  pos2     Positions of the nodes in @p grid2, negative for
+ *                       nodes which are not part of it.
+ *  \param[in]  mesh     global mesh dimensions.
+ *  \param[in]  mesh_off global mesh offset (see \ref p3m_data_struct).
+ *  \param[in]  comm     MPI communicator.
+ *  \return Nodes to send to and nodes to receive from at each step.
+ */
+std::pair<std::vector<int>, std::vector<int>>
+find_comm_steps(int const *grid1, Utils::Span<const int> pos1,
+                int const *grid2, Utils::Span<const int> pos2,
+                int const *mesh, double const *mesh_off,
+                boost::mpi::communicator const &comm) {
+  std::vector<int> send_group, recv_group;
+  int block[6];
+  auto const this_node = comm.rank();
+
+  for (int d = 0; d < comm.size(); d++) {
+    auto const dst = (this_node + d) % comm.size();
+    auto const src = (this_node - d + comm.size()) % comm.size();
+    auto const send_size =
+        (pos2[3 * dst] >= 0)
+            ? calc_send_block(&(pos1[3 * this_node]), grid1, &(pos2[3 * dst]),
+                              grid2, mesh, mesh_off, block)
+            : 0;
+    auto const recv_size =
+        (pos2[3 * this_node] >= 0)
+            ? calc_send_block(&(pos2[3 * this_node]), grid2, &(pos1[3 * src]),
+                              grid1, mesh, mesh_off, block)
+            : 0;
+    if (send_size > 0 or recv_size > 0) {
+      send_group.push_back((send_size > 0) ? dst : MPI_PROC_NULL);
+      recv_group.push_back((recv_size > 0) ? src : MPI_PROC_NULL);
+    }
+  }
+  return {send_group, recv_group};
+}
+
+/** Execute an in-place FFTW plan, nodes without local mesh have none. */
+void execute_fftw_plan(fftw_plan plan, fftw_complex *data) {
+  if (plan) {
+    fftw_execute_dft(plan, data, data);
+  }
+}
+
+/** FFTW plans, indexed by transform length, number of transforms,
+ *  direction and planner flags. Plans are kept for the lifetime of the
+ *  process, such that re-initializing the FFT for a mesh layout that was
+ *  already seen (e.g. during P3M tuning, or after a box change) doesn't
+ *  invoke the FFTW planner again.
+ */
+std::map<std::tuple<int, int, int, unsigned>, fftw_plan> fftw_plan_cache;
+
+/** Get a plan for @p howmany in-place 1D FFTs of length @p n from the cache,
+ *  or create it. Plans are executed with the new-array execute functions,
+ *  so @p data only needs to be aligned like the arrays passed later on.
+ */
+fftw_plan get_fftw_plan(int n, int howmany, int dir, unsigned flags,
+                        fftw_complex *data) {
+  auto const key = std::make_tuple(n, howmany, dir, flags);
+  auto it = fftw_plan_cache.find(key);
+  if (it == fftw_plan_cache.end()) {
+    auto const plan = fftw_plan_many_dft(1, &n, howmany, data, nullptr, 1, n,
+                                         data, nullptr, 1, n, dir, flags);
+    it = fftw_plan_cache.emplace(key, plan).first;
+  }
+  return it->second;
+}
 } // namespace
 
 int fft_init(Utils::Vector3i const &ca_mesh_dim, int const *ca_mesh_margin,
              Utils::Vector3i const &global_mesh_dim,
              Utils::Vector3d const &global_mesh_off, int &ks_pnum,
              fft_data_struct &fft, Utils::Vector3i const &grid,
-             boost::mpi::communicator const &comm) {
+             boost::mpi::communicator const &comm, bool fast_planning,
+             int n_fft_nodes, FFTDecomposition decomposition) {
 
   int n_grid[4][3];         /* The four node grids. */
   int my_pos[4][3];         /* The position of comm.rank() in the node grids. */
@@ -494,11 +625,22 @@ int fft_init(Utils::Vector3i const &ca_mesh_dim, int const *ca_mesh_margin,
   int node_pos[3];
   MPI_Cart_coords(comm, comm.rank(), 3, node_pos);
 
+  if (n_fft_nodes <= 0) {
+    n_fft_nodes = comm.size();
+  }
+  if (comm.size() % n_fft_nodes != 0) {
+    throw std::runtime_error(
+        "The number of FFT nodes must be a divisor of the number of nodes");
+  }
+  /* the FFT nodes are spread evenly over the communicator */
+  auto const fft_node_stride = comm.size() / n_fft_nodes;
+  auto const is_fft_node = (comm.rank() % fft_node_stride) == 0;
+
   fft.max_comm_size = 0;
   fft.max_mesh_size = 0;
   for (int i = 0; i < 4; i++) {
     n_id[i].resize(1 * comm.size());
-    n_pos[i].resize(3 * comm.size());
+    n_pos[i].assign(3 * comm.size(), -1);
   }
 
   /* === node grids === */
@@ -516,9 +658,21 @@ int fft_init(Utils::Vector3i const &ca_mesh_dim, int const *ca_mesh_margin,
   }
 
   /* FFT node grids (n_grid[1 - 3]) */
-  calc_2d_grid(comm.size(), n_grid[1]);
+  auto const use_slabs =
+      use_slab_decomposition(decomposition, global_mesh_dim, n_fft_nodes);
+  if (use_slabs) {
+    n_grid[1][0] = n_fft_nodes;
+    n_grid[1][1] = 1;
+    n_grid[1][2] = 1;
+  } else {
+    calc_2d_grid(n_fft_nodes, n_grid[1]);
+  }
   /* resort n_grid[1] dimensions if necessary */
   fft.plan[1].row_dir = map_3don2d_grid(n_grid[0], n_grid[1]);
+  if (fft.plan[1].row_dir == -1) {
+    /* the grids don't match, keep the rows along the last dimension */
+    fft.plan[1].row_dir = 2;
+  }
   fft.plan[0].n_permute = 0;
   for (int i = 1; i < 4; i++)
     fft.plan[i].n_permute = (fft.plan[1].row_dir + i) % 3;
@@ -528,55 +682,111 @@ int fft_init(Utils::Vector3i const &ca_mesh_dim, int const *ca_mesh_margin,
   }
   fft.plan[2].row_dir = (fft.plan[1].row_dir - 1) % 3;
   fft.plan[3].row_dir = (fft.plan[1].row_dir - 2) % 3;
+  if (use_slabs) {
+    /* keep the slabs of the previous plan, unless they are cut along the
+     * new row direction: then cut them along the previous row direction,
+     * such that only one of the two transposes has to move data */
+    for (int i = 2; i < 4; i++) {
+      auto const row_dir = (fft.plan[i].row_dir + 3) % 3;
+      auto const prev_row_dir = (fft.plan[i - 1].row_dir + 3) % 3;
+      for (int j = 0; j < 3; j++)
+        n_grid[i][j] = n_grid[i - 1][j];
+      std::swap(n_grid[i][row_dir], n_grid[i][prev_row_dir]);
+    }
+  }
 
   /* === communication groups === */
   /* copy local mesh off real space charge assignment grid */
   for (int i = 0; i < 3; i++)
     fft.plan[0].new_mesh[i] = ca_mesh_dim[i];
 
+  /* place the FFT nodes on n_grid[1], if possible such that each of them
+   * only needs data from its neighbors in the real space node grid */
+  using Utils::make_span;
+  auto const is_aligned =
+      n_fft_nodes == comm.size() and
+      find_comm_groups({n_grid[0][0], n_grid[0][1], n_grid[0][2]},
+                       {n_grid[1][0], n_grid[1][1], n_grid[1][2]}, n_id[0],
+                       make_span(n_id[1]), make_span(n_pos[1]), my_pos[1],
+                       comm);
+  if (not is_aligned) {
+    for (int i = 0; i < n_fft_nodes; i++) {
+      auto const node = i * fft_node_stride;
+      int const pos[3] = {i % n_grid[1][0], (i / n_grid[1][0]) % n_grid[1][1],
+                          i / (n_grid[1][0] * n_grid[1][1])};
+      n_id[1][i] = node;
+      for (int j = 0; j < 3; j++) {
+        n_pos[1][3 * node + j] = pos[j];
+        if (node == comm.rank())
+          my_pos[1][j] = pos[j];
+      }
+    }
+  }
+
   for (int i = 1; i < 4; i++) {
-    using Utils::make_span;
-    auto group = find_comm_groups(
-        {n_grid[i - 1][0], n_grid[i - 1][1], n_grid[i - 1][2]},
-        {n_grid[i][0], n_grid[i][1], n_grid[i][2]}, n_id[i - 1],
-        make_span(n_id[i]), make_span(n_pos[i]), my_pos[i], comm);
-    if (not group) {
-      /* try permutation */
-      std::swap(n_grid[i][(fft.plan[i].row_dir + 1) % 3],
-                n_grid[i][(fft.plan[i].row_dir + 2) % 3]);
-
-      group = find_comm_groups(
+    if (i == 1) {
+      /* from all nodes to the FFT nodes */
+      std::tie(fft.plan[i].group, fft.plan[i].recv_group) = find_comm_steps(
+          n_grid[0], n_pos[0], n_grid[1], n_pos[1], global_mesh_dim.data(),
+          global_mesh_off.data(), comm);
+    } else if (is_fft_node) {
+      auto group = find_comm_groups(
           {n_grid[i - 1][0], n_grid[i - 1][1], n_grid[i - 1][2]},
-          {n_grid[i][0], n_grid[i][1], n_grid[i][2]}, make_span(n_id[i - 1]),
+          {n_grid[i][0], n_grid[i][1], n_grid[i][2]}, n_id[i - 1],
           make_span(n_id[i]), make_span(n_pos[i]), my_pos[i], comm);
-
       if (not group) {
-        throw std::runtime_error("INTERNAL ERROR: fft_find_comm_groups error");
+        /* try permutation */
+        std::swap(n_grid[i][(fft.plan[i].row_dir + 1) % 3],
+                  n_grid[i][(fft.plan[i].row_dir + 2) % 3]);
+
+        group = find_comm_groups(
+            {n_grid[i - 1][0], n_grid[i - 1][1], n_grid[i - 1][2]},
+            {n_grid[i][0], n_grid[i][1], n_grid[i][2]}, make_span(n_id[i - 1]),
+            make_span(n_id[i]), make_span(n_pos[i]), my_pos[i], comm);
+
+        if (not group) {
+          throw std::runtime_error(
+              "INTERNAL ERROR: fft_find_comm_groups error");
+        }
       }
+      fft.plan[i].group = *group;
+      fft.plan[i].recv_group = *group;
+    } else {
+      /* the other nodes don't take part in the transposes */
+      fft.plan[i].group.clear();
+      fft.plan[i].recv_group.clear();
     }
 
-    fft.plan[i].group = *group;
-
-    fft.plan[i].send_block.resize(6 * fft.plan[i].group.size());
-    fft.plan[i].send_size.resize(fft.plan[i].group.size());
-    fft.plan[i].recv_block.resize(6 * fft.plan[i].group.size());
-    fft.plan[i].recv_size.resize(fft.plan[i].group.size());
-
-    fft.plan[i].new_size = calc_local_mesh(
-        my_pos[i], n_grid[i], global_mesh_dim.data(), global_mesh_off.data(),
-        fft.plan[i].new_mesh, fft.plan[i].start);
-    permute_ifield(fft.plan[i].new_mesh, 3, -(fft.plan[i].n_permute));
-    permute_ifield(fft.plan[i].start, 3, -(fft.plan[i].n_permute));
+    fft.plan[i].send_block.assign(6 * fft.plan[i].group.size(), 0);
+    fft.plan[i].send_size.assign(fft.plan[i].group.size(), 0);
+    fft.plan[i].recv_block.assign(6 * fft.plan[i].group.size(), 0);
+    fft.plan[i].recv_size.assign(fft.plan[i].group.size(), 0);
+
+    if (is_fft_node) {
+      fft.plan[i].new_size = calc_local_mesh(
+          my_pos[i], n_grid[i], global_mesh_dim.data(), global_mesh_off.data(),
+          fft.plan[i].new_mesh, fft.plan[i].start);
+      permute_ifield(fft.plan[i].new_mesh, 3, -(fft.plan[i].n_permute));
+      permute_ifield(fft.plan[i].start, 3, -(fft.plan[i].n_permute));
+    } else {
+      fft.plan[i].new_size = 0;
+      for (int j = 0; j < 3; j++) {
+        fft.plan[i].new_mesh[j] = 0;
+        fft.plan[i].start[j] = 0;
+      }
+    }
     fft.plan[i].n_ffts = fft.plan[i].new_mesh[0] * fft.plan[i].new_mesh[1];
 
     /* === send/recv block specifications === */
     for (int j = 0; j < fft.plan[i].group.size(); j++) {
       /* send block: comm.rank() to comm-group-node i (identity: node) */
       int node = fft.plan[i].group[j];
-      fft.plan[i].send_size[j] = calc_send_block(
-          my_pos[i - 1], n_grid[i - 1], &(n_pos[i][3 * node]), n_grid[i],
-          global_mesh_dim.data(), global_mesh_off.data(),
-          &(fft.plan[i].send_block[6 * j]));
+      if (node != MPI_PROC_NULL) {
+        fft.plan[i].send_size[j] = calc_send_block(
+            my_pos[i - 1], n_grid[i - 1], &(n_pos[i][3 * node]), n_grid[i],
+            global_mesh_dim.data(), global_mesh_off.data(),
+            &(fft.plan[i].send_block[6 * j]));
+      }
       permute_ifield(&(fft.plan[i].send_block[6 * j]), 3,
                      -(fft.plan[i - 1].n_permute));
       permute_ifield(&(fft.plan[i].send_block[6 * j + 3]), 3,
@@ -591,10 +801,13 @@ int fft_init(Utils::Vector3i const &ca_mesh_dim, int const *ca_mesh_margin,
           fft.plan[1].send_block[6 * j + k] += ca_mesh_margin[2 * k];
       }
       /* recv block: comm.rank() from comm-group-node i (identity: node) */
-      fft.plan[i].recv_size[j] = calc_send_block(
-          my_pos[i], n_grid[i], &(n_pos[i - 1][3 * node]), n_grid[i - 1],
-          global_mesh_dim.data(), global_mesh_off.data(),
-          &(fft.plan[i].recv_block[6 * j]));
+      node = fft.plan[i].recv_group[j];
+      if (node != MPI_PROC_NULL) {
+        fft.plan[i].recv_size[j] = calc_send_block(
+            my_pos[i], n_grid[i], &(n_pos[i - 1][3 * node]), n_grid[i - 1],
+            global_mesh_dim.data(), global_mesh_off.data(),
+            &(fft.plan[i].recv_block[6 * j]));
+      }
       permute_ifield(&(fft.plan[i].recv_block[6 * j]), 3,
                      -(fft.plan[i].n_permute));
       permute_ifield(&(fft.plan[i].recv_block[6 * j + 3]), 3,
@@ -636,35 +849,45 @@ int fft_init(Utils::Vector3i const &ca_mesh_dim, int const *ca_mesh_margin,
     ks_pnum = 5;
   }
 
-  fft.send_buf.resize(fft.max_comm_size);
-  fft.recv_buf.resize(fft.max_comm_size);
-  fft.data_buf.resize(fft.max_mesh_size);
+  fft.send_buf.resize(fft_max_batch_size * fft.max_comm_size);
+  fft.recv_buf.resize(fft_max_batch_size * fft.max_comm_size);
+  fft.data_buf.resize(fft_max_batch_size * fft.max_mesh_size);
   auto *c_data = (fftw_complex *)(fft.data_buf.data());
+  /* cheap plans for trial meshes, expensive plans for production runs */
+  auto const planner_flags = (fast_planning) ? FFTW_ESTIMATE : FFTW_PATIENT;
 
   /* === FFT Routines (Using FFTW / RFFTW package)=== */
   for (int i = 1; i < 4; i++) {
     fft.plan[i].dir = FFTW_FORWARD;
     /* FFT plan creation.*/
-
-    if (fft.init_tag)
-      fftw_destroy_plan(fft.plan[i].our_fftw_plan);
-    fft.plan[i].our_fftw_plan = fftw_plan_many_dft(
-        1, &fft.plan[i].new_mesh[2], fft.plan[i].n_ffts, c_data, nullptr, 1,
-        fft.plan[i].new_mesh[2], c_data, nullptr, 1, fft.plan[i].new_mesh[2],
-        fft.plan[i].dir, FFTW_PATIENT);
+    fft.plan[i].our_fftw_plan =
+        (fft.plan[i].new_size > 0)
+            ? get_fftw_plan(fft.plan[i].new_mesh[2], fft.plan[i].n_ffts,
+                            fft.plan[i].dir, planner_flags, c_data)
+            : nullptr;
+    fft.plan[i].our_fftw_batch_plan =
+        (fft.plan[i].new_size > 0)
+            ? get_fftw_plan(fft.plan[i].new_mesh[2],
+                            fft_max_batch_size * fft.plan[i].n_ffts,
+                            fft.plan[i].dir, planner_flags, c_data)
+            : nullptr;
   }
 
   /* === The BACK Direction === */
   /* this is needed because slightly different functions are used */
   for (int i = 1; i < 4; i++) {
     fft.back[i].dir = FFTW_BACKWARD;
-
-    if (fft.init_tag)
-      fftw_destroy_plan(fft.back[i].our_fftw_plan);
-    fft.back[i].our_fftw_plan = fftw_plan_many_dft(
-        1, &fft.plan[i].new_mesh[2], fft.plan[i].n_ffts, c_data, nullptr, 1,
-        fft.plan[i].new_mesh[2], c_data, nullptr, 1, fft.plan[i].new_mesh[2],
-        fft.back[i].dir, FFTW_PATIENT);
+    fft.back[i].our_fftw_plan =
+        (fft.plan[i].new_size > 0)
+            ? get_fftw_plan(fft.plan[i].new_mesh[2], fft.plan[i].n_ffts,
+                            fft.back[i].dir, planner_flags, c_data)
+            : nullptr;
+    fft.back[i].our_fftw_batch_plan =
+        (fft.plan[i].new_size > 0)
+            ? get_fftw_plan(fft.plan[i].new_mesh[2],
+                            fft_max_batch_size * fft.plan[i].n_ffts,
+                            fft.back[i].dir, planner_flags, c_data)
+            : nullptr;
 
     fft.back[i].pack_function = pack_block_permute1;
   }
@@ -679,77 +902,132 @@ int fft_init(Utils::Vector3i const &ca_mesh_dim, int const *ca_mesh_margin,
   return fft.max_mesh_size;
 }
 
+namespace {
+/** Pointers to consecutive chunks of the FFT data buffer, one per mesh. */
+auto data_buf_chunks(fft_data_struct &fft, int n_meshes, int chunk_size) {
+  std::array<double *, fft_max_batch_size> chunks{};
+  for (int k = 0; k < n_meshes; k++) {
+    chunks[k] = fft.data_buf.data() + k * chunk_size;
+  }
+  return chunks;
+}
+} // namespace
+
 void fft_perform_forw(double *data, fft_data_struct &fft,
                       const boost::mpi::communicator &comm) {
-  /* ===== first direction  ===== */
-
-  auto *c_data = (fftw_complex *)data;
-  auto *c_data_buf = (fftw_complex *)fft.data_buf.data();
-
-  /* communication to current dir row format (in is data) */
-  forw_grid_comm(fft.plan[1], data, fft.data_buf.data(), fft, comm);
+  fft_perform_forw(Utils::Span<double *const>(&data, 1), fft, comm);
+}
 
-  /* complexify the real data array (in is fft.data_buf) */
-  for (int i = 0; i < fft.plan[1].new_size; i++) {
-    data[2 * i + 0] = fft.data_buf[i]; /* real value */
-    data[2 * i + 1] = 0;               /* complex value */
+void fft_perform_forw(Utils::Span<double *const> meshes, fft_data_struct &fft,
+                      const boost::mpi::communicator &comm) {
+  auto const n_meshes = static_cast<int>(meshes.size());
+  if (n_meshes != 1 and n_meshes != fft_max_batch_size) {
+    /* no batched FFTW plans for this number of meshes */
+    for (auto *data : meshes) {
+      fft_perform_forw(data, fft, comm);
+    }
+    return;
+  }
+  /* the 1D FFTs of the second direction run on fft.data_buf, where the
+   * meshes are stored contiguously and can be transformed in one go */
+  auto const mid_size = 2 * fft.plan[2].new_size;
+  auto const mid_plan = (n_meshes == 1) ? fft.plan[2].our_fftw_plan
+                                        : fft.plan[2].our_fftw_batch_plan;
+  auto const row_chunks = data_buf_chunks(fft, n_meshes, fft.max_mesh_size);
+  auto const mid_chunks = data_buf_chunks(fft, n_meshes, mid_size);
+  auto const rows = Utils::Span<double *const>(row_chunks.data(), n_meshes);
+  auto const mids = Utils::Span<double *const>(mid_chunks.data(), n_meshes);
+
+  /* communication to current dir row format (in is meshes) */
+  forw_grid_comm(fft.plan[1], meshes, rows, fft, comm);
+
+  for (int k = 0; k < n_meshes; k++) {
+    auto *data = meshes[k];
+    /* complexify the real data array (in is fft.data_buf) */
+    for (int i = 0; i < fft.plan[1].new_size; i++) {
+      data[2 * i + 0] = rows[k][i]; /* real value */
+      data[2 * i + 1] = 0;          /* complex value */
+    }
+    /* perform FFT (in/out is data)*/
+    execute_fftw_plan(fft.plan[1].our_fftw_plan, (fftw_complex *)data);
   }
-  /* perform FFT (in/out is data)*/
-  fftw_execute_dft(fft.plan[1].our_fftw_plan, c_data, c_data);
   /* ===== second direction ===== */
-  /* communication to current dir row format (in is data) */
-  forw_grid_comm(fft.plan[2], data, fft.data_buf.data(), fft, comm);
+  /* communication to current dir row format (in is meshes) */
+  forw_grid_comm(fft.plan[2], meshes, mids, fft, comm);
   /* perform FFT (in/out is fft.data_buf) */
-  fftw_execute_dft(fft.plan[2].our_fftw_plan, c_data_buf, c_data_buf);
+  execute_fftw_plan(mid_plan, (fftw_complex *)fft.data_buf.data());
   /* ===== third direction  ===== */
   /* communication to current dir row format (in is fft.data_buf) */
-  forw_grid_comm(fft.plan[3], fft.data_buf.data(), data, fft, comm);
-  /* perform FFT (in/out is data)*/
-  fftw_execute_dft(fft.plan[3].our_fftw_plan, c_data, c_data);
+  forw_grid_comm(fft.plan[3], mids, meshes, fft, comm);
+  /* perform FFT (in/out is meshes)*/
+  for (auto *data : meshes) {
+    execute_fftw_plan(fft.plan[3].our_fftw_plan, (fftw_complex *)data);
+  }
 
-  /* REMARK: Result has to be in data. */
+  /* REMARK: Result has to be in meshes. */
 }
 
 void fft_perform_back(double *data, bool check_complex, fft_data_struct &fft,
                       const boost::mpi::communicator &comm) {
+  fft_perform_back(Utils::Span<double *const>(&data, 1), check_complex, fft,
+                   comm);
+}
 
-  auto *c_data = (fftw_complex *)data;
-  auto *c_data_buf = (fftw_complex *)fft.data_buf.data();
+void fft_perform_back(Utils::Span<double *const> meshes, bool check_complex,
+                      fft_data_struct &fft,
+                      const boost::mpi::communicator &comm) {
+  auto const n_meshes = static_cast<int>(meshes.size());
+  if (n_meshes != 1 and n_meshes != fft_max_batch_size) {
+    /* no batched FFTW plans for this number of meshes */
+    for (auto *data : meshes) {
+      fft_perform_back(data, check_complex, fft, comm);
+    }
+    return;
+  }
+  auto const mid_size = 2 * fft.plan[2].new_size;
+  auto const mid_plan = (n_meshes == 1) ? fft.back[2].our_fftw_plan
+                                        : fft.back[2].our_fftw_batch_plan;
+  auto const row_chunks = data_buf_chunks(fft, n_meshes, fft.max_mesh_size);
+  auto const mid_chunks = data_buf_chunks(fft, n_meshes, mid_size);
+  auto const rows = Utils::Span<double *const>(row_chunks.data(), n_meshes);
+  auto const mids = Utils::Span<double *const>(mid_chunks.data(), n_meshes);
 
   /* ===== third direction  ===== */
 
-  /* perform FFT (in is data) */
-  fftw_execute_dft(fft.back[3].our_fftw_plan, c_data, c_data);
-  /* communicate (in is data)*/
-  back_grid_comm(fft.plan[3], fft.back[3], data, fft.data_buf.data(), fft,
-                 comm);
+  /* perform FFT (in is meshes) */
+  for (auto *data : meshes) {
+    execute_fftw_plan(fft.back[3].our_fftw_plan, (fftw_complex *)data);
+  }
+  /* communicate (in is meshes)*/
+  back_grid_comm(fft.plan[3], fft.back[3], meshes, mids, fft, comm);
 
   /* ===== second direction ===== */
   /* perform FFT (in is fft.data_buf) */
-  fftw_execute_dft(fft.back[2].our_fftw_plan, c_data_buf, c_data_buf);
+  execute_fftw_plan(mid_plan, (fftw_complex *)fft.data_buf.data());
   /* communicate (in is fft.data_buf) */
-  back_grid_comm(fft.plan[2], fft.back[2], fft.data_buf.data(), data, fft,
-                 comm);
+  back_grid_comm(fft.plan[2], fft.back[2], mids, meshes, fft, comm);
 
   /* ===== first direction  ===== */
-  /* perform FFT (in is data) */
-  fftw_execute_dft(fft.back[1].our_fftw_plan, c_data, c_data);
-  /* throw away the (hopefully) empty complex component (in is data) */
-  for (int i = 0; i < fft.plan[1].new_size; i++) {
-    fft.data_buf[i] = data[2 * i]; /* real value */
-    // Vincent:
-    if (check_complex and std::abs(data[2 * i + 1]) > 1e-5) {
-      printf("Complex value is not zero (i=%d,data=%g)!!!\n", i,
-             data[2 * i + 1]);
-      if (i > 100)
-        throw std::runtime_error("Complex value is not zero");
+  for (int k = 0; k < n_meshes; k++) {
+    auto *data = meshes[k];
+    /* perform FFT (in is data) */
+    execute_fftw_plan(fft.back[1].our_fftw_plan, (fftw_complex *)data);
+    /* throw away the (hopefully) empty complex component (in is data) */
+    for (int i = 0; i < fft.plan[1].new_size; i++) {
+      rows[k][i] = data[2 * i]; /* real value */
+      // Vincent:
+      if (check_complex and std::abs(data[2 * i + 1]) > 1e-5) {
+        printf("Complex value is not zero (i=%d,data=%g)!!!\n", i,
+               data[2 * i + 1]);
+        if (i > 100)
+          throw std::runtime_error("Complex value is not zero");
+      }
     }
   }
   /* communicate (in is fft.data_buf) */
-  back_grid_comm(fft.plan[1], fft.back[1], fft.data_buf.data(), data, fft,
-                 comm);
+  back_grid_comm(fft.plan[1], fft.back[1], rows, meshes, fft, comm);
 
-  /* REMARK: Result has to be in data. */
+  /* REMARK: Result has to be in meshes. */
 }
 
 void fft_pack_block(double const *const in, double *const out,
@@ -799,4 +1077,46 @@ void fft_unpack_block(double const *const in, double *const out,
     li_out += s_out_offset;
   }
 }
+
+void fft_import_wisdom(std::string const &filename,
+                       boost::mpi::communicator const &comm) {
+  std::string wisdom;
+  if (comm.rank() == 0) {
+    std::ifstream file(filename);
+    if (file) {
+      std::stringstream buffer;
+      buffer << file.rdbuf();
+      wisdom = buffer.str();
+    }
+  }
+  boost::mpi::broadcast(comm, wisdom, 0);
+  if (not wisdom.empty() and
+      fftw_import_wisdom_from_string(wisdom.c_str()) == 0) {
+    throw std::runtime_error("Cannot import FFTW wisdom from file '" +
+                             filename + "'");
+  }
+}
+
+void fft_export_wisdom(std::string const &filename,
+                       boost::mpi::communicator const &comm) {
+  /* the local meshes differ between ranks: merge all wisdom on the head
+   * node before writing it to disk */
+  auto *const local_wisdom = fftw_export_wisdom_to_string();
+  auto const wisdom = std::string{local_wisdom};
+  fftw_free(local_wisdom);
+  std::vector<std::string> all_wisdom;
+  boost::mpi::gather(comm, wisdom, all_wisdom, 0);
+  auto success = 1;
+  if (comm.rank() == 0) {
+    for (auto const &item : all_wisdom) {
+      fftw_import_wisdom_from_string(item.c_str());
+    }
+    success = fftw_export_wisdom_to_filename(filename.c_str());
+  }
+  boost::mpi::broadcast(comm, success, 0);
+  if (success == 0) {
+    throw std::runtime_error("Cannot export FFTW wisdom to file '" +
+                             filename + "'");
+  }
+}
 #endif
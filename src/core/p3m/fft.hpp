@@ -46,6 +46,10 @@
 
 #if defined(P3M) || defined(DP3M)
 
+#include "memory_usage.hpp"
+#include "p3m/common.hpp"
+
+#include <utils/Span.hpp>
 #include <utils/Vector.hpp>
 
 #include <boost/mpi/communicator.hpp>
@@ -54,8 +58,14 @@
 
 #include <cstddef>
 #include <new>
+#include <string>
 #include <vector>
 
+/** Maximal number of meshes transformed together by the batched 3D-FFT,
+ *  e.g. the three components of a vector field.
+ */
+auto constexpr fft_max_batch_size = 3;
+
 /** Aligned allocator for fft data. */
 template <class T> struct fft_allocator {
   typedef T value_type;
@@ -102,6 +112,8 @@ struct fft_forw_plan {
   int n_ffts;
   /** plan for fft. */
   fftw_plan our_fftw_plan;
+  /** plan for the ffts of @ref fft_max_batch_size meshes at once. */
+  fftw_plan our_fftw_batch_plan;
 
   /** size of local mesh before communication. */
   int old_mesh[3];
@@ -112,8 +124,11 @@ struct fft_forw_plan {
   /** size of new mesh (number of mesh points). */
   int new_size;
 
-  /** group of nodes which have to communicate with each other. */
+  /** nodes to send to, one per communication step (or @c MPI_PROC_NULL). */
   std::vector<int> group;
+  /** nodes to receive from, one per communication step
+   *  (or @c MPI_PROC_NULL). */
+  std::vector<int> recv_group;
 
   /** packing function for send blocks. */
   void (*pack_function)(double const *const, double *const, int const *,
@@ -136,6 +151,8 @@ struct fft_back_plan {
   int dir;
   /** plan for fft. */
   fftw_plan our_fftw_plan;
+  /** plan for the ffts of @ref fft_max_batch_size meshes at once. */
+  fftw_plan our_fftw_batch_plan;
 
   /** packing function for send blocks. */
   void (*pack_function)(double const *const, double *const, int const *,
@@ -158,18 +175,25 @@ struct fft_data_struct { // NOLINT(bugprone-reserved-identifier)
   /** Whether FFT is initialized or not. */
   bool init_tag = false;
 
-  /** Maximal size of the communication buffers. */
+  /** Maximal size of the communication buffers for one mesh. */
   int max_comm_size = 0;
 
   /** Maximal local mesh size. */
   int max_mesh_size = 0;
 
-  /** send buffer. */
+  /** send buffer, large enough for a batch of meshes. */
   std::vector<double> send_buf;
-  /** receive buffer. */
+  /** receive buffer, large enough for a batch of meshes. */
   std::vector<double> recv_buf;
-  /** Buffer for receive data. */
+  /** Buffer for receive data, large enough for a batch of meshes. */
   fft_vector<double> data_buf;
+
+  /** Heap memory of the buffers, in bytes. */
+  std::size_t memory_usage() const {
+    return MemoryUsage::heap_size(send_buf) +
+           MemoryUsage::heap_size(recv_buf) +
+           MemoryUsage::heap_size(data_buf);
+  }
 };
 
 /** Initialize everything connected to the 3D-FFT.
@@ -182,13 +206,39 @@ struct fft_data_struct { // NOLINT(bugprone-reserved-identifier)
  *  \param[out] fft             FFT plan.
  *  \param[in]  grid            Number of nodes in each spatial dimension.
  *  \param[in]  comm            MPI communicator.
+ *  \param[in]  fast_planning   Use cheap FFTW plans (e.g. for the trial
+ *                              meshes of the P3M tuning) instead of
+ *                              measuring the fastest algorithm.
+ *  \param[in]  n_fft_nodes     Number of nodes performing the 1D FFTs,
+ *                              must divide the number of nodes. The other
+ *                              nodes only send their charge assignment mesh
+ *                              and receive the result. Use all nodes if
+ *                              not positive.
+ *  \param[in]  decomposition   Decomposition of the mesh onto the FFT
+ *                              nodes (slabs or pencils).
  *  \return Maximal size of local fft mesh (needed for allocation of ca_mesh).
  */
 int fft_init(Utils::Vector3i const &ca_mesh_dim, int const *ca_mesh_margin,
              Utils::Vector3i const &global_mesh_dim,
              Utils::Vector3d const &global_mesh_off, int &ks_pnum,
              fft_data_struct &fft, Utils::Vector3i const &grid,
-             boost::mpi::communicator const &comm);
+             boost::mpi::communicator const &comm, bool fast_planning,
+             int n_fft_nodes, FFTDecomposition decomposition);
+
+/** Import FFTW wisdom from a file. The file is read on the head node.
+ *  Nothing is imported if the file doesn't exist.
+ *  \param[in]  filename  Path to the wisdom file.
+ *  \param[in]  comm      MPI communicator.
+ */
+void fft_import_wisdom(std::string const &filename,
+                       boost::mpi::communicator const &comm);
+
+/** Export the FFTW wisdom accumulated by all nodes to a file.
+ *  \param[in]  filename  Path to the wisdom file.
+ *  \param[in]  comm      MPI communicator.
+ */
+void fft_export_wisdom(std::string const &filename,
+                       boost::mpi::communicator const &comm);
 
 /** Perform an in-place forward 3D FFT.
  *  \warning The content of \a data is overwritten.
@@ -199,6 +249,18 @@ int fft_init(Utils::Vector3i const &ca_mesh_dim, int const *ca_mesh_margin,
 void fft_perform_forw(double *data, fft_data_struct &fft,
                       const boost::mpi::communicator &comm);
 
+/** Perform in-place forward 3D FFTs of several meshes at once.
+ *  The meshes share the communication steps of the transposes, i.e. each
+ *  pair of nodes exchanges one message per step for all meshes, and the
+ *  1D FFTs are batched where the memory layout allows it.
+ *  \warning The content of \a meshes is overwritten.
+ *  \param[in,out] meshes  Meshes, at most @ref fft_max_batch_size.
+ *  \param[in,out] fft     FFT plan.
+ *  \param[in]     comm    MPI communicator
+ */
+void fft_perform_forw(Utils::Span<double *const> meshes, fft_data_struct &fft,
+                      const boost::mpi::communicator &comm);
+
 /** Perform an in-place backward 3D FFT.
  *  \warning The content of \a data is overwritten.
  *  \param[in,out] data           Mesh.
@@ -210,6 +272,20 @@ void fft_perform_forw(double *data, fft_data_struct &fft,
 void fft_perform_back(double *data, bool check_complex, fft_data_struct &fft,
                       const boost::mpi::communicator &comm);
 
+/** Perform in-place backward 3D FFTs of several meshes at once, with the
+ *  same batching of the communication and of the 1D FFTs as in the forward
+ *  direction.
+ *  \warning The content of \a meshes is overwritten.
+ *  \param[in,out] meshes         Meshes, at most @ref fft_max_batch_size.
+ *  \param[in]     check_complex  Throw an error if the complex component is
+ *                                non-zero.
+ *  \param[in,out] fft            FFT plan.
+ *  \param[in]     comm           MPI communicator.
+ */
+void fft_perform_back(Utils::Span<double *const> meshes, bool check_complex,
+                      fft_data_struct &fft,
+                      const boost::mpi::communicator &comm);
+
 /** Pack a block (<tt>size[3]</tt> starting at <tt>start[3]</tt>) of an input
  *  3d-grid with dimension <tt>dim[3]</tt> into an output 3d-block with
  *  dimension <tt>size[3]</tt>.
@@ -21,6 +21,8 @@
 #ifndef ESPRESSO_CORE_P3M_INTERPOLATION_HPP
 #define ESPRESSO_CORE_P3M_INTERPOLATION_HPP
 
+#include "memory_usage.hpp"
+
 #include <utils/Span.hpp>
 #include <utils/index.hpp>
 #include <utils/math/bspline.hpp>
@@ -66,6 +68,14 @@ public:
    */
   auto size() const { return ca_fmp.size(); }
 
+  /**
+   * @brief Heap memory held by the cache.
+   * @return The size of the allocated storage in bytes.
+   */
+  std::size_t memory_usage() const {
+    return MemoryUsage::heap_size(ca_frac) + MemoryUsage::heap_size(ca_fmp);
+  }
+
   /**
    * @brief Charge assignment order the weights are for.
    * @return The charge assignment order.
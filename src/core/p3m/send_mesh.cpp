@@ -34,6 +34,7 @@
 
 #include <mpi.h>
 
+#include <cassert>
 #include <cstddef>
 #include <utility>
 
@@ -148,12 +149,81 @@ void p3m_send_mesh::resize(const boost::mpi::communicator &comm,
 void p3m_send_mesh::gather_grid(Utils::Span<double *> meshes,
                                 const boost::mpi::communicator &comm,
                                 const Utils::Vector3i &dim) {
+  gather_grid_begin(meshes, comm, dim);
+  gather_grid_finish(meshes, comm, dim);
+}
+
+void p3m_send_mesh::gather_grid_begin(Utils::Span<double *> meshes,
+                                      const boost::mpi::communicator &comm,
+                                      const Utils::Vector3i &dim) {
+  assert(requests.empty());
+  auto const node_neighbors = Utils::Mpi::cart_neighbors<3>(comm);
+  auto const n_meshes = static_cast<int>(meshes.size());
+
+  /* The send blocks of the first two directions are halo slabs, while the
+   * recv blocks are added to the inner mesh, so both exchanges can be
+   * in flight at the same time. */
+  for (int s_dir = 0; s_dir < 2; s_dir++) {
+    auto const r_dir = (s_dir % 2 == 0) ? s_dir + 1 : s_dir - 1;
+    auto &send_buf = async_send_grid[s_dir];
+    auto &recv_buf = async_recv_grid[s_dir];
+    send_buf.resize(s_size[s_dir] * meshes.size());
+    recv_buf.resize(r_size[r_dir] * meshes.size());
+
+    /* pack send block */
+    if (s_size[s_dir] > 0)
+      for (std::size_t i = 0; i < meshes.size(); i++) {
+        fft_pack_block(meshes[i], send_buf.data() + i * s_size[s_dir],
+                       s_ld[s_dir], s_dim[s_dir], dim.data(), 1);
+      }
+
+    /* communication */
+    if (node_neighbors[s_dir] != comm.rank()) {
+      requests.emplace_back();
+      MPI_Irecv(recv_buf.data(), n_meshes * r_size[r_dir], MPI_DOUBLE,
+                node_neighbors[r_dir], REQ_P3M_GATHER_ASYNC + s_dir, comm,
+                &requests.back());
+      requests.emplace_back();
+      MPI_Isend(send_buf.data(), n_meshes * s_size[s_dir], MPI_DOUBLE,
+                node_neighbors[s_dir], REQ_P3M_GATHER_ASYNC + s_dir, comm,
+                &requests.back());
+    } else {
+      std::swap(send_buf, recv_buf);
+    }
+  }
+}
+
+void p3m_send_mesh::gather_grid_finish(Utils::Span<double *> meshes,
+                                       const boost::mpi::communicator &comm,
+                                       const Utils::Vector3i &dim) {
+  MPI_Waitall(static_cast<int>(requests.size()), requests.data(),
+              MPI_STATUSES_IGNORE);
+  requests.clear();
+
+  /* add recv blocks of the first two directions */
+  for (int s_dir = 0; s_dir < 2; s_dir++) {
+    auto const r_dir = (s_dir % 2 == 0) ? s_dir + 1 : s_dir - 1;
+    if (r_size[r_dir] > 0) {
+      for (std::size_t i = 0; i < meshes.size(); i++) {
+        p3m_add_block(async_recv_grid[s_dir].data() + i * r_size[r_dir],
+                      meshes[i], r_ld[r_dir], r_dim[r_dir], dim.data());
+      }
+    }
+  }
+
+  gather_directions(meshes, comm, dim, 2);
+}
+
+void p3m_send_mesh::gather_directions(Utils::Span<double *> meshes,
+                                      const boost::mpi::communicator &comm,
+                                      const Utils::Vector3i &dim,
+                                      int first_dir) {
   auto const node_neighbors = Utils::Mpi::cart_neighbors<3>(comm);
   send_grid.resize(max * meshes.size());
   recv_grid.resize(max * meshes.size());
 
   /* direction loop */
-  for (int s_dir = 0; s_dir < 6; s_dir++) {
+  for (int s_dir = first_dir; s_dir < 6; s_dir++) {
     auto const r_dir = (s_dir % 2 == 0) ? s_dir + 1 : s_dir - 1;
 
     /* pack send block */
@@ -25,6 +25,7 @@
 
 #if defined(P3M) || defined(DP3M)
 
+#include "memory_usage.hpp"
 #include "p3m/common.hpp"
 
 #include <utils/Span.hpp>
@@ -32,6 +33,10 @@
 
 #include <boost/mpi/communicator.hpp>
 
+#include <mpi.h>
+
+#include <array>
+#include <cstddef>
 #include <vector>
 
 /** Structure for send/recv meshes. */
@@ -39,7 +44,8 @@ class p3m_send_mesh {
   enum Requests {
     REQ_P3M_INIT = 200,
     REQ_P3M_GATHER = 201,
-    REQ_P3M_SPREAD = 202
+    REQ_P3M_SPREAD = 202,
+    REQ_P3M_GATHER_ASYNC = 203
   };
   /** dimension of sub meshes to send. */
   int s_dim[6][3];
@@ -64,6 +70,15 @@ class p3m_send_mesh {
   std::vector<double> send_grid;
   /** vector to store grid points to recv */
   std::vector<double> recv_grid;
+  /** buffers of the non-blocking first gather stage, one per direction. */
+  std::array<std::vector<double>, 2> async_send_grid;
+  std::array<std::vector<double>, 2> async_recv_grid;
+  /** pending requests of the non-blocking first gather stage. */
+  std::vector<MPI_Request> requests;
+
+  void gather_directions(Utils::Span<double *> meshes,
+                         const boost::mpi::communicator &comm,
+                         const Utils::Vector3i &dim, int first_dir);
 
 public:
   void resize(const boost::mpi::communicator &comm,
@@ -75,6 +90,32 @@ public:
                    const Utils::Vector3i &dim) {
     gather_grid(Utils::make_span(&mesh, 1), comm, dim);
   }
+  /**
+   * @brief Start the halo summation of the meshes without blocking.
+   *
+   * The two exchanges along the first Cartesian direction don't depend
+   * on each other and are posted as non-blocking messages, such that
+   * they can travel while the caller does unrelated work. The meshes
+   * must not be modified until @ref gather_grid_finish is called.
+   */
+  void gather_grid_begin(Utils::Span<double *> meshes,
+                         const boost::mpi::communicator &comm,
+                         const Utils::Vector3i &dim);
+  /** @brief Complete a halo summation started by @ref gather_grid_begin. */
+  void gather_grid_finish(Utils::Span<double *> meshes,
+                          const boost::mpi::communicator &comm,
+                          const Utils::Vector3i &dim);
+  /** @brief Whether a halo summation was started and not yet completed. */
+  bool gather_pending() const { return not requests.empty(); }
+  /** @brief Heap memory of the communication buffers, in bytes. */
+  std::size_t memory_usage() const {
+    return MemoryUsage::heap_size(send_grid) +
+           MemoryUsage::heap_size(recv_grid) +
+           MemoryUsage::heap_size(async_send_grid[0]) +
+           MemoryUsage::heap_size(async_send_grid[1]) +
+           MemoryUsage::heap_size(async_recv_grid[0]) +
+           MemoryUsage::heap_size(async_recv_grid[1]);
+  }
   void spread_grid(Utils::Span<double *> meshes,
                    const boost::mpi::communicator &comm,
                    const Utils::Vector3i &dim);
@@ -26,6 +26,7 @@
 #include "communication.hpp"
 #include "event.hpp"
 #include "grid.hpp"
+#include "memory_usage.hpp"
 #include "nonbonded_interactions/nonbonded_interaction_data.hpp"
 #include "partCfg_global.hpp"
 
@@ -36,6 +37,7 @@
 #include <utils/mpi/gatherv.hpp>
 
 #include <boost/mpi/collectives/all_gather.hpp>
+#include <boost/mpi/collectives/all_reduce.hpp>
 #include <boost/mpi/collectives/gather.hpp>
 #include <boost/mpi/collectives/reduce.hpp>
 #include <boost/mpi/collectives/scatter.hpp>
@@ -45,6 +47,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <functional>
 #include <iterator>
 #include <stdexcept>
@@ -155,6 +158,23 @@ Utils::Cache<int, Particle> particle_fetch_cache(max_cache_size);
 void invalidate_fetch_cache() { particle_fetch_cache.invalidate(); }
 std::size_t fetch_cache_max_size() { return particle_fetch_cache.max_size(); }
 
+std::size_t fetch_cache_memory_usage() {
+  return MemoryUsage::hash_table_heap_size<std::pair<int const, Particle>>(
+      particle_fetch_cache.size(), particle_fetch_cache.bucket_count());
+}
+
+std::size_t type_map_memory_usage() {
+  auto bytes = MemoryUsage::hash_table_heap_size(particle_type_map);
+  for (auto const &kv : particle_type_map) {
+    bytes += MemoryUsage::hash_table_heap_size(kv.second);
+  }
+  return bytes;
+}
+
+std::size_t particle_node_memory_usage() {
+  return MemoryUsage::hash_table_heap_size(particle_node);
+}
+
 static boost::optional<const Particle &> get_particle_data_local(int p_id) {
   auto p = cell_structure.get_local_particle(p_id);
 
@@ -521,9 +541,36 @@ void make_new_particle(int p_id, Utils::Vector3d const &pos) {
   mpi_synchronize_max_seen_pid_local();
 }
 
+void make_new_particles(std::vector<Particle> &&particles) {
+  auto local_max_type = -1;
+  for (auto &p : particles) {
+    local_max_type = std::max(local_max_type, p.type());
+    ::cell_structure.add_particle(std::move(p));
+  }
+  particles.clear();
+  auto const max_type = boost::mpi::all_reduce(::comm_cart, local_max_type,
+                                               boost::mpi::maximum<int>());
+  if (max_type >= 0) {
+    make_particle_type_exist(max_type);
+  }
+  on_particle_change();
+  /* send the particles to the ranks that own their positions */
+  cells_update_ghosts(global_ghost_flags());
+  clear_particle_node();
+
+  if (::type_list_enable) {
+    auto types = Utils::keys(::particle_type_map);
+    boost::sort(types);
+    for (auto const type : types) {
+      init_type_map(type);
+    }
+  }
+}
+
 void set_particle_pos(int p_id, Utils::Vector3d const &pos) {
   auto const has_moved = maybe_move_particle(p_id, pos);
-  ::cell_structure.set_resort_particles(Cells::RESORT_GLOBAL);
+  ::cell_structure.set_resort_particles(Cells::RESORT_GLOBAL,
+                                        Cells::REBUILD_PARTICLE_CHANGE);
   on_particle_change();
 
   auto success = false;
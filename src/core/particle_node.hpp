@@ -70,6 +70,15 @@ void invalidate_fetch_cache();
  */
 std::size_t fetch_cache_max_size();
 
+/** @brief Heap memory of the fetch cache for get_particle_data, in bytes. */
+std::size_t fetch_cache_memory_usage();
+
+/** @brief Heap memory of the particle type map, in bytes. */
+std::size_t type_map_memory_usage();
+
+/** @brief Heap memory of the map of particle ids to MPI ranks, in bytes. */
+std::size_t particle_node_memory_usage();
+
 /** Invalidate \ref particle_node. This has to be done
  *  at the beginning of the integration.
  */
@@ -83,6 +92,17 @@ void clear_particle_node();
  */
 void make_new_particle(int p_id, Utils::Vector3d const &pos);
 
+/**
+ * @brief Insert particles in bulk.
+ * Collective call: each rank inserts its own particles, which are then sent
+ * to the ranks that own their positions in a single global resort. This is
+ * much faster than @ref make_new_particle for large numbers of particles.
+ * The particle ids must be unique and not in use.
+ * Also call @ref on_particle_change.
+ * @param particles  The particles to insert on this rank.
+ */
+void make_new_particles(std::vector<Particle> &&particles);
+
 /**
  * @brief Move particle to a new position.
  * Also call @ref on_particle_change.
@@ -42,6 +42,7 @@
 #include <iterator>
 #include <limits>
 #include <map>
+#include <numeric>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -142,6 +143,10 @@ bool ReactionAlgorithm::all_reactant_particles_exist(
 
 void ReactionAlgorithm::make_reaction_attempt(SingleReaction const &reaction,
                                               ParticleChanges &bookkeeping) {
+  if (m_number_of_trial_positions > 1) {
+    make_configurational_bias_reaction_attempt(reaction, bookkeeping);
+    return;
+  }
   // create or hide particles of types with corresponding types in reaction
   auto const n_product_types = reaction.product_types.size();
   auto const n_reactant_types = reaction.reactant_types.size();
@@ -218,6 +223,77 @@ void ReactionAlgorithm::make_reaction_attempt(SingleReaction const &reaction,
   }
 }
 
+void ReactionAlgorithm::make_configurational_bias_reaction_attempt(
+    SingleReaction const &reaction, ParticleChanges &bookkeeping) {
+  auto const n_product_types = reaction.product_types.size();
+  auto const n_reactant_types = reaction.reactant_types.size();
+  // draw the particles to change and to hide without replacement
+  std::vector<int> drawn_p_ids;
+  auto const draw_random_p_id_of_type = [this, &drawn_p_ids](int type) {
+    int p_id;
+    do {
+      auto const random_index = i_random(number_of_particles_with_type(type));
+      p_id = get_random_p_id(type, random_index);
+    } while (Utils::contains(drawn_p_ids, p_id));
+    drawn_p_ids.emplace_back(p_id);
+    return p_id;
+  };
+  std::vector<std::tuple<int, int, int>> changed;
+  std::vector<std::tuple<int, int>> hidden;
+  std::vector<int> created;
+  for (int i = 0; i < std::max(n_product_types, n_reactant_types); i++) {
+    auto const n_reactant_coef =
+        (i < n_reactant_types) ? reaction.reactant_coefficients[i] : 0;
+    auto const n_product_coef =
+        (i < n_product_types) ? reaction.product_coefficients[i] : 0;
+    auto const n_changed = std::min(n_product_coef, n_reactant_coef);
+    for (int j = 0; j < n_changed; j++) {
+      auto const old_type = reaction.reactant_types[i];
+      auto const p_id = draw_random_p_id_of_type(old_type);
+      changed.emplace_back(p_id, old_type, reaction.product_types[i]);
+    }
+    for (int j = n_changed; j < n_reactant_coef; j++) {
+      auto const type = reaction.reactant_types[i];
+      hidden.emplace_back(draw_random_p_id_of_type(type), type);
+    }
+    for (int j = n_changed; j < n_product_coef; j++) {
+      created.emplace_back(reaction.product_types[i]);
+    }
+  }
+  // hide particles in the reverse order of their creation by the backward
+  // reaction, such that the Rosenbluth weights of both moves are evaluated
+  // in the same configurations
+  for (auto it = hidden.rbegin(); it != hidden.rend(); ++it) {
+    auto const [p_id, type] = *it;
+    bookkeeping.hidden.emplace_back(p_id, type);
+    bookkeeping.configurational_bias *= calculate_deletion_bias(p_id, type);
+    hide_particle(p_id, type);
+    on_particle_change();
+    if (particle_inside_exclusion_range_touched) {
+      return;
+    }
+  }
+  for (auto const &[p_id, old_type, new_type] : changed) {
+    on_particle_type_change(p_id, old_type, new_type);
+    if (auto p = get_local_particle(p_id)) {
+      p->type() = new_type;
+#ifdef ELECTROSTATICS
+      p->q() = charges_of_types.at(new_type);
+#endif
+    }
+    bookkeeping.changed.emplace_back(p_id, old_type);
+  }
+  on_particle_change();
+  for (auto const type : created) {
+    auto const p_id = create_particle(type);
+    bookkeeping.created.emplace_back(p_id);
+    bookkeeping.configurational_bias *= insert_particle_with_bias(p_id, type);
+    if (particle_inside_exclusion_range_touched) {
+      return;
+    }
+  }
+}
+
 std::unordered_map<int, int>
 ReactionAlgorithm::get_particle_numbers(SingleReaction const &reaction) const {
   std::unordered_map<int, int> particle_numbers;
@@ -261,7 +337,8 @@ double ReactionAlgorithm::make_reaction_mc_move_attempt(int reaction_id,
   auto &reaction = *reactions[reaction_id];
   reaction.accumulator_potential_energy_difference_exponential(
       std::vector<double>{exponential});
-  if (get_random_uniform_number() >= bf) {
+  auto const bias = get_old_system_state().configurational_bias;
+  if (get_random_uniform_number() >= bf * bias) {
     // reject trial move: restore previous state, energy is unchanged
     restore_old_system_state();
     return E_pot_old;
@@ -369,6 +446,98 @@ void ReactionAlgorithm::check_exclusion_range(int p_id, int p_type) {
   boost::mpi::broadcast(m_comm, particle_inside_exclusion_range_touched, 0);
 }
 
+/**
+ * Short-range energy of a particle, or infinity if the particle is inside
+ * the exclusion range of another particle. The exclusion flag is left
+ * unchanged.
+ */
+double ReactionAlgorithm::calculate_trial_energy(int p_id, int p_type) {
+  auto const touched = particle_inside_exclusion_range_touched;
+  particle_inside_exclusion_range_touched = false;
+  check_exclusion_range(p_id, p_type);
+  auto const excluded = particle_inside_exclusion_range_touched;
+  particle_inside_exclusion_range_touched = touched;
+  if (excluded) {
+    return std::numeric_limits<double>::infinity();
+  }
+  auto const energy = particle_short_range_energy_contribution(p_id);
+  return boost::mpi::all_reduce(m_comm, energy, std::plus<>());
+}
+
+/**
+ * Place a created particle at one of several random trial positions, with
+ * probability proportional to the Boltzmann factor of its short-range energy.
+ * @returns Rosenbluth weight of the trial positions divided by the number
+ * of trial positions and by the Boltzmann factor of the selected position.
+ */
+double ReactionAlgorithm::insert_particle_with_bias(int p_id, int p_type) {
+  auto const n_trials = m_number_of_trial_positions;
+  std::vector<Utils::Vector3d> positions(n_trials);
+  std::vector<double> energies(n_trials);
+  for (int i = 0; i < n_trials; i++) {
+    positions[i] = get_random_position_in_box();
+    ::set_particle_pos(p_id, positions[i]);
+    energies[i] = calculate_trial_energy(p_id, p_type);
+  }
+  // Boltzmann factors relative to the lowest energy, to avoid underflow
+  auto const energy_min = *std::min_element(energies.begin(), energies.end());
+  if (energy_min == std::numeric_limits<double>::infinity()) {
+    particle_inside_exclusion_range_touched = true;
+    return 1.;
+  }
+  std::vector<double> weights(n_trials);
+  std::transform(energies.begin(), energies.end(), weights.begin(),
+                 [this, energy_min](double energy) {
+                   return std::exp(-(energy - energy_min) / kT);
+                 });
+  auto const weight_sum = std::accumulate(weights.begin(), weights.end(), 0.);
+  auto threshold = weight_sum * get_random_uniform_number();
+  auto selected = 0;
+  while (selected < n_trials - 1 and threshold >= weights[selected]) {
+    threshold -= weights[selected];
+    ++selected;
+  }
+  ::set_particle_pos(p_id, positions[selected]);
+  return weight_sum / (n_trials * weights[selected]);
+}
+
+/**
+ * Rosenbluth weight of a particle that is about to be hidden, evaluated at
+ * its current position and at additional random trial positions.
+ * @returns Number of trial positions times the Boltzmann factor of the
+ * current position, divided by the Rosenbluth weight.
+ */
+double ReactionAlgorithm::calculate_deletion_bias(int p_id, int p_type) {
+  auto const n_trials = m_number_of_trial_positions;
+  std::vector<double> energies(n_trials);
+  energies[0] = calculate_trial_energy(p_id, p_type);
+  if (energies[0] == std::numeric_limits<double>::infinity()) {
+    particle_inside_exclusion_range_touched = true;
+    return 1.;
+  }
+  auto pos = Utils::Vector3d{};
+  if (auto const p = get_real_particle(p_id)) {
+    pos = unfolded_position(p->pos(), p->image_box(), box_geo.length());
+    if (m_comm.rank() != 0) {
+      m_comm.send(0, 43, pos);
+    }
+  } else if (m_comm.rank() == 0) {
+    m_comm.recv(boost::mpi::any_source, 43, pos);
+  }
+  boost::mpi::broadcast(m_comm, pos, 0);
+  for (int i = 1; i < n_trials; i++) {
+    ::set_particle_pos(p_id, get_random_position_in_box());
+    energies[i] = calculate_trial_energy(p_id, p_type);
+  }
+  ::set_particle_pos(p_id, pos);
+  auto const energy_min = *std::min_element(energies.begin(), energies.end());
+  auto weight_sum = 0.;
+  for (auto const energy : energies) {
+    weight_sum += std::exp(-(energy - energy_min) / kT);
+  }
+  return n_trials * std::exp(-(energies[0] - energy_min) / kT) / weight_sum;
+}
+
 /**
  * Deletes the particle with the given p_id and stores the id if the deletion
  * created a hole in the particle id range. This method is intended to only
@@ -117,6 +117,15 @@ public:
     exclusion_radius_per_type = map;
     m_max_exclusion_range = max_exclusion_range;
   }
+  auto get_number_of_trial_positions() const {
+    return m_number_of_trial_positions;
+  }
+  void set_number_of_trial_positions(int value) {
+    if (value < 1) {
+      throw std::domain_error("Invalid value for 'number_of_trial_positions'");
+    }
+    m_number_of_trial_positions = value;
+  }
 
   void remove_constraint() { m_reaction_constraint = ReactionConstraint::NONE; }
   void set_cyl_constraint(double center_x, double center_y, double radius);
@@ -149,6 +158,8 @@ public:
     std::vector<std::tuple<int, Utils::Vector3d, Utils::Vector3d>> moved{};
     std::unordered_map<int, int> old_particle_numbers{};
     int reaction_id{-1};
+    /** Correction of the acceptance probability for biased insertions */
+    double configurational_bias{1.};
   };
 
   bool is_reaction_under_way() const { return m_system_changes != nullptr; }
@@ -185,7 +196,8 @@ public:
   std::optional<double> create_new_trial_state(int reaction_id);
   /**
    * Accept or reject a reaction MC move made by @ref create_new_trial_state
-   * based on a probability acceptance @c bf.
+   * based on a probability acceptance @c bf. The probability is corrected
+   * for the bias of configurational-bias insertions and deletions.
    * The previous state of the system is either restored from the cache if
    * the move is rejected, or cleared from the cache if the move is accepted.
    * @returns Potential energy of the system after the move was accepted or
@@ -218,6 +230,20 @@ protected:
   void make_reaction_attempt(::ReactionMethods::SingleReaction const &reaction,
                              ParticleChanges &bookkeeping);
 
+  /**
+   * @brief Carry out a chemical reaction with configurational-bias
+   * insertions and deletions and save the old system state.
+   * Particles are hidden first, in the reverse order in which the
+   * backward reaction would create them, then the particle types are
+   * changed and the new particles are created. Each created particle
+   * is placed at one of @ref m_number_of_trial_positions random positions,
+   * selected with its Rosenbluth weight @cite frenkel02b. The bias
+   * is stored in the bookkeeping.
+   */
+  void make_configurational_bias_reaction_attempt(
+      ::ReactionMethods::SingleReaction const &reaction,
+      ParticleChanges &bookkeeping);
+
 public:
   /**
    * @brief draws a random integer from the uniform distribution in the range
@@ -245,6 +271,9 @@ private:
   int create_particle(int p_type);
   void hide_particle(int p_id, int p_type) const;
   void check_exclusion_range(int p_id, int p_type);
+  double calculate_trial_energy(int p_id, int p_type);
+  double insert_particle_with_bias(int p_id, int p_type);
+  double calculate_deletion_bias(int p_id, int p_type);
   auto get_random_uniform_number() {
     return m_uniform_real_distribution(m_generator);
   }
@@ -262,6 +291,8 @@ private:
   double m_slab_start_z = -10.0;
   double m_slab_end_z = -10.0;
   double m_max_exclusion_range = 0.;
+  /** Number of trial positions of configurational-bias insertions */
+  int m_number_of_trial_positions = 1;
 
   Particle *get_real_particle(int p_id) const;
   Particle *get_local_particle(int p_id) const;
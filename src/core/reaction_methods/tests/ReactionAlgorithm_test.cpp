@@ -218,6 +218,76 @@ BOOST_FIXTURE_TEST_CASE(ReactionAlgorithm_test, ParticleFactory) {
     remove_particle(1);
   }
 
+  // check configurational-bias reaction moves
+  {
+    BOOST_CHECK_THROW(r_algo.set_number_of_trial_positions(0),
+                      std::domain_error);
+    r_algo.set_number_of_trial_positions(4);
+    BOOST_CHECK_EQUAL(r_algo.get_number_of_trial_positions(), 4);
+    // set up reactions A -> 3 B + 4 C and 3 B + 4 C -> A
+    r_algo.add_reaction(std::make_shared<SingleReaction>(
+        reaction.gamma, reaction.reactant_types, reaction.reactant_coefficients,
+        reaction.product_types, reaction.product_coefficients));
+    r_algo.add_reaction(std::make_shared<SingleReaction>(
+        1. / reaction.gamma, reaction.product_types,
+        reaction.product_coefficients, reaction.reactant_types,
+        reaction.reactant_coefficients));
+    auto const ref_pos = Utils::Vector3d{0.1, 0.2, 0.3};
+    ::make_new_particle(0, ref_pos);
+    set_particle_type(0, type_A);
+    r_algo.setup_bookkeeping_of_empty_pids();
+    // forward reaction: without interactions, all trial positions have the
+    // same Rosenbluth weight and the move is unbiased
+    BOOST_REQUIRE(r_algo.create_new_trial_state(0));
+    {
+      auto const &bookkeeping = r_algo.get_old_system_state();
+      BOOST_CHECK_EQUAL(bookkeeping.changed.size(), 1ul);
+      BOOST_CHECK_EQUAL(bookkeeping.created.size(), 6ul);
+      BOOST_CHECK_EQUAL(bookkeeping.hidden.size(), 0ul);
+      BOOST_CHECK_CLOSE(bookkeeping.configurational_bias, 1., tol);
+    }
+    BOOST_CHECK_EQUAL(::number_of_particles_with_type(type_B), 3);
+    BOOST_CHECK_EQUAL(::number_of_particles_with_type(type_C), 4);
+    r_algo.make_reaction_mc_move_attempt(0, 2., 0., 0.);
+    BOOST_REQUIRE(!r_algo.is_reaction_under_way());
+    BOOST_CHECK_EQUAL(::number_of_particles_with_type(type_A), 0);
+    // backward reaction: hidden particles are restored to their positions
+    std::unordered_map<int, Utils::Vector3d> positions;
+    for (int p_id = 0; p_id < 7; ++p_id) {
+      auto const p = ::cell_structure.get_local_particle(p_id);
+      if (p != nullptr and not p->is_ghost()) {
+        positions[p_id] = p->pos();
+      }
+    }
+    BOOST_REQUIRE(r_algo.create_new_trial_state(1));
+    {
+      auto const &bookkeeping = r_algo.get_old_system_state();
+      BOOST_CHECK_EQUAL(bookkeeping.changed.size(), 1ul);
+      BOOST_CHECK_EQUAL(bookkeeping.created.size(), 0ul);
+      BOOST_CHECK_EQUAL(bookkeeping.hidden.size(), 6ul);
+      BOOST_CHECK_CLOSE(bookkeeping.configurational_bias, 1., tol);
+    }
+    BOOST_CHECK_EQUAL(::number_of_particles_with_type(type_A), 1);
+    BOOST_CHECK_EQUAL(::number_of_particles_with_type(type_B), 0);
+    BOOST_CHECK_EQUAL(::number_of_particles_with_type(type_C), 0);
+    r_algo.make_reaction_mc_move_attempt(1, 0., 0., 0.);
+    BOOST_REQUIRE(!r_algo.is_reaction_under_way());
+    BOOST_CHECK_EQUAL(::number_of_particles_with_type(type_B), 3);
+    BOOST_CHECK_EQUAL(::number_of_particles_with_type(type_C), 4);
+    for (auto const &[p_id, ref_pos] : positions) {
+      auto const p = ::cell_structure.get_local_particle(p_id);
+      BOOST_REQUIRE(p != nullptr);
+      BOOST_CHECK_LE((p->pos() - ref_pos).norm(), tol);
+    }
+    // cleanup
+    for (int p_id = 0; p_id < 7; ++p_id) {
+      remove_particle(p_id);
+    }
+    r_algo.delete_reaction(1);
+    r_algo.delete_reaction(0);
+    r_algo.set_number_of_trial_positions(1);
+  }
+
   // check random positions generator
   {
     // setup box
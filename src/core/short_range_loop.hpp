@@ -32,6 +32,7 @@ namespace detail {
  */
 struct True {
   template <class... T> bool operator()(T &...) const { return true; }
+  True with_skin(double) const { return {}; }
 };
 } // namespace detail
 
@@ -32,6 +32,8 @@
 #include <utils/Vector.hpp>
 #include <utils/matrix.hpp>
 
+#include <cmath>
+
 /** Langevin thermostat for particle translational velocities.
  *  Collects the particle velocity (different for ENGINE, PARTICLE_ANISOTROPY).
  *  Collects the langevin parameters kT, gamma (different for
@@ -96,6 +98,76 @@ friction_thermo_langevin(LangevinThermostat const &langevin, Particle const &p,
                         langevin.rng_counter(), langevin.rng_seed(), p.id());
 }
 
+/** Exact solution of the Ornstein-Uhlenbeck process of the particle
+ *  translational velocity over one time step, used in the O step of the
+ *  BAOAB integrator @cite leimkuhler13a:
+ *  \f[ v \leftarrow u + e^{-\gamma \Delta t/m} (v - u)
+ *      + \sqrt{k_B T/m (1 - e^{-2 \gamma \Delta t/m})} \, \xi \f]
+ *  with \f$ u \f$ the swimming velocity (ENGINE) and \f$ \xi \f$ a vector
+ *  of independent Gaussian random numbers. Collects the langevin parameter
+ *  gamma (different for THERMOSTAT_PER_PARTICLE, PARTICLE_ANISOTROPY).
+ *  @param[in]     langevin       Parameters
+ *  @param[in]     p              %Particle
+ *  @param[in]     time_step      Duration of the O step
+ *  @param[in]     kT             Temperature
+ *  @return the new particle velocity
+ */
+inline Utils::Vector3d
+langevin_ou_velocity(LangevinThermostat const &langevin, Particle const &p,
+                     double time_step, double kT) {
+  auto gamma = langevin.gamma;
+#ifdef THERMOSTAT_PER_PARTICLE
+  // override default if particle-specific gamma
+  if (p.gamma() >= Thermostat::GammaType{}) {
+    gamma = p.gamma();
+  }
+#endif // THERMOSTAT_PER_PARTICLE
+
+  auto const decay = [&](double g) {
+    return std::exp(-g * time_step / p.mass());
+  };
+  auto const noise = [&](double c) {
+    return std::sqrt(kT / p.mass() * (1. - c * c));
+  };
+
+  // Get the reference velocity of the friction
+#ifdef ENGINE
+  auto const drift = (p.swimming().v_swim != 0)
+                         ? p.swimming().v_swim * p.calc_director()
+                         : Utils::Vector3d{};
+#else
+  auto const drift = Utils::Vector3d{};
+#endif // ENGINE
+#ifdef PARTICLE_ANISOTROPY
+  Utils::Vector3d pref_decay, pref_noise;
+  for (unsigned int j = 0; j < 3; j++) {
+    pref_decay[j] = decay(gamma[j]);
+    pref_noise[j] = noise(pref_decay[j]);
+  }
+  // Particle frictional isotropy check
+  auto const aniso_flag = (gamma[0] != gamma[1]) || (gamma[1] != gamma[2]);
+
+  // In case of anisotropic particle: body-fixed reference frame. Otherwise:
+  // lab-fixed reference frame.
+  const Utils::Matrix<double, 3, 3> decay_mat =
+      boost::qvm::diag_mat(pref_decay);
+  const Utils::Matrix<double, 3, 3> noise_mat =
+      boost::qvm::diag_mat(pref_noise);
+
+  auto const decay_op =
+      aniso_flag ? convert_body_to_space(p, decay_mat) : decay_mat;
+  auto const noise_op =
+      aniso_flag ? convert_body_to_space(p, noise_mat) : noise_mat;
+#else
+  auto const decay_op = decay(gamma);
+  auto const noise_op = noise(decay_op);
+#endif // PARTICLE_ANISOTROPY
+
+  return drift + decay_op * (p.v() - drift) +
+         noise_op * Random::noise_gaussian<RNGSalt::LANGEVIN>(
+                        langevin.rng_counter(), langevin.rng_seed(), p.id());
+}
+
 #ifdef ROTATION
 /** Langevin thermostat for particle angular velocities.
  *  Collects the particle velocity (different for PARTICLE_ANISOTROPY).
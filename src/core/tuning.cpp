@@ -33,14 +33,20 @@
 
 #include <boost/mpi/collectives/all_reduce.hpp>
 #include <boost/mpi/collectives/broadcast.hpp>
+#include <boost/mpi/operations.hpp>
+#include <boost/optional.hpp>
 #include <boost/range/algorithm/max_element.hpp>
 #include <boost/range/algorithm/min_element.hpp>
 
 #include <mpi.h>
 
 #include <algorithm>
+#include <cmath>
 #include <functional>
+#include <limits>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 std::string TuningFailed::get_first_error() const {
   using namespace ErrorHandling;
@@ -156,3 +162,114 @@ void tune_skin(double min_skin, double max_skin, double tol, int int_steps,
   auto const new_skin = 0.5 * (a + b);
   ::set_skin(new_skin);
 }
+
+namespace {
+struct CellSystemConfiguration {
+  CellStructureType decomposition;
+  double cell_size_factor;
+  bool use_verlet_list;
+  double skin;
+};
+
+/** Search space of the last cell system tuning. */
+boost::optional<CellSystemTuningParameters> cell_system_tuning_params;
+/** Particle number density at the last cell system tuning. */
+double cell_system_tuning_density = 0.;
+} // namespace
+
+static auto get_cell_system_configuration() {
+  return CellSystemConfiguration{::cell_structure.decomposition_type(),
+                                 ::cell_structure.cell_size_factor,
+                                 ::cell_structure.use_verlet_list, ::skin};
+}
+
+static void set_cell_system_configuration(CellSystemConfiguration const &cfg) {
+  ::cell_structure.use_verlet_list = cfg.use_verlet_list;
+  ::cell_structure.cell_size_factor = cfg.cell_size_factor;
+  cells_re_init(cfg.decomposition);
+  ::set_skin(cfg.skin);
+}
+
+static double get_particle_number_density() {
+  auto const n_part_local =
+      static_cast<double>(::cell_structure.local_particles().size());
+  auto const n_part =
+      boost::mpi::all_reduce(::comm_cart, n_part_local, std::plus<double>());
+  return n_part / box_geo.volume();
+}
+
+void tune_cell_system(CellSystemTuningParameters const &params) {
+  if (std::find(params.decompositions.begin(), params.decompositions.end(),
+                CellStructureType::CELL_STRUCTURE_HYBRID) !=
+      params.decompositions.end()) {
+    throw std::invalid_argument(
+        "The hybrid decomposition cannot be tuned automatically");
+  }
+  auto const initial_cfg = get_cell_system_configuration();
+  auto best_cfg = initial_cfg;
+  auto best_time = std::numeric_limits<double>::max();
+
+  auto const benchmark = [&](CellSystemConfiguration const &cfg) {
+    set_cell_system_configuration(cfg);
+    auto const time_local = time_calc(params.int_steps);
+    if (time_local < 0.) {
+      /* this configuration is not valid for the current system */
+      flush_runtime_errors_local();
+      return;
+    }
+    /* all ranks must agree on the timings */
+    auto const time = boost::mpi::all_reduce(::comm_cart, time_local,
+                                             boost::mpi::maximum<double>());
+    if (time < best_time) {
+      best_time = time;
+      best_cfg = cfg;
+    }
+  };
+
+  for (auto const decomposition : params.decompositions) {
+    auto const cell_size_factors =
+        (decomposition == CellStructureType::CELL_STRUCTURE_REGULAR)
+            ? params.cell_size_factors
+            : std::vector<double>{initial_cfg.cell_size_factor};
+    for (auto const cell_size_factor : cell_size_factors) {
+      for (auto const use_verlet_list : params.use_verlet_lists) {
+        for (auto const skin : params.skins) {
+          benchmark({decomposition, cell_size_factor, use_verlet_list, skin});
+        }
+      }
+    }
+  }
+
+  if (best_time == std::numeric_limits<double>::max()) {
+    set_cell_system_configuration(initial_cfg);
+    throw std::runtime_error("tuning failed: none of the cell system "
+                             "configurations could be integrated");
+  }
+
+  set_cell_system_configuration(best_cfg);
+  cell_system_tuning_params = params;
+  cell_system_tuning_density = get_particle_number_density();
+}
+
+void tune_cell_system_on_density_change() {
+  if (not cell_system_tuning_params or
+      cell_system_tuning_params->density_tolerance <= 0.) {
+    return;
+  }
+  auto const density = get_particle_number_density();
+  auto const change = std::fabs(density - cell_system_tuning_density);
+  if (change > cell_system_tuning_params->density_tolerance *
+                   cell_system_tuning_density) {
+    auto const params = *cell_system_tuning_params;
+    try {
+      tune_cell_system(params);
+    } catch (std::runtime_error const &) {
+      /* the previous configuration was restored; avoid retrying every call */
+      cell_system_tuning_density = density;
+      if (this_node == 0) {
+        runtimeWarningMsg() << "cell system retuning failed, keeping the "
+                               "current configuration";
+      }
+    }
+  }
+}
@@ -22,8 +22,11 @@
 #ifndef ESPRESSO_SRC_CORE_TUNING_HPP
 #define ESPRESSO_SRC_CORE_TUNING_HPP
 
+#include "cell_system/CellStructureType.hpp"
+
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 class TuningFailed : public std::runtime_error {
   std::string get_first_error() const;
@@ -48,4 +51,36 @@ double benchmark_integration_step(int int_steps);
 void tune_skin(double min_skin, double max_skin, double tol, int int_steps,
                bool adjust_max_skin);
 
+/** @brief Search space of the cell system tuning. */
+struct CellSystemTuningParameters {
+  /** Particle decompositions to benchmark. */
+  std::vector<CellStructureType> decompositions;
+  /** Cell size factors to benchmark (regular decomposition only). */
+  std::vector<double> cell_size_factors;
+  /** Verlet list modes to benchmark. */
+  std::vector<bool> use_verlet_lists;
+  /** Skins to benchmark. */
+  std::vector<double> skins;
+  /** Number of integration steps per candidate. */
+  int int_steps;
+  /** Relative change of the particle number density that triggers
+   *  a new tuning, or 0 to disable automatic retuning.
+   */
+  double density_tolerance;
+};
+
+/** @brief Select the fastest cell system configuration.
+ *  Every combination of decomposition, cell size factor, Verlet list mode
+ *  and skin is timed over @p params.int_steps integration steps, which
+ *  propagate the system. Candidates that cannot be integrated are skipped.
+ *  The fastest configuration is kept and the search space is stored for
+ *  @ref tune_cell_system_on_density_change.
+ */
+void tune_cell_system(CellSystemTuningParameters const &params);
+
+/** @brief Re-run @ref tune_cell_system if the particle number density
+ *  changed by more than the tolerance since the last tuning.
+ */
+void tune_cell_system_on_density_change();
+
 #endif
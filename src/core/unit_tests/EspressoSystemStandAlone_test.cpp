@@ -59,6 +59,7 @@ namespace utf = boost::unit_test;
 #include <limits>
 #include <memory>
 #include <stdexcept>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -275,9 +276,12 @@ BOOST_FIXTURE_TEST_CASE(espresso_system_stand_alone, ParticleFactory) {
                              Utils::Vector3d::broadcast(0.5),
                              5,
                              0.615,
-                             1e-3};
+                             1e-3,
+                             0,
+                             FFTDecomposition::AUTO};
     auto solver =
-        std::make_shared<CoulombP3M>(std::move(p3m), prefactor, 1, false, true);
+        std::make_shared<CoulombP3M>(std::move(p3m), prefactor, 1, false, true,
+                                     std::string{}, 0, 2.);
     ::Coulomb::add_actor(solver);
 
     // measure energies
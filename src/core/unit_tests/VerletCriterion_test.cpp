@@ -59,6 +59,17 @@ BOOST_AUTO_TEST_CASE(VerletCriterion_test) {
     BOOST_CHECK(!criterion_inactive(p1, p2, above));
   }
 
+  {
+    auto constexpr inner_skin = 0.1;
+    auto const criterion_inner = criterion.with_skin(inner_skin);
+    auto constexpr cutoff = inner_skin + max_cut;
+    auto const below = Distance{Utils::Vector3d{cutoff - 0.05, 0.0, 0.0}};
+    auto const above = Distance{Utils::Vector3d{cutoff + 0.05, 0.0, 0.0}};
+    BOOST_CHECK(criterion_inner(p1, p2, below));
+    BOOST_CHECK(!criterion_inner(p1, p2, above));
+    BOOST_CHECK(criterion(p1, p2, above));
+  }
+
 #ifdef ELECTROSTATICS
   {
     auto constexpr cutoff = skin + coulomb_cut;
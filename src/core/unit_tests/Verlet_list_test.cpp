@@ -128,6 +128,7 @@ struct : public IntegratorHelper {
 #ifdef NPT
 struct : public IntegratorHelper {
   void set_integrator() const override {
+    ::nptiso = NptIsoParameters{}; // discard barostat state of previous runs
     ::nptiso = NptIsoParameters(1., 1e9, {true, true, true}, true);
     set_integ_switch(INTEG_METHOD_NPT_ISO);
     mpi_set_temperature_local(1.);
@@ -164,9 +165,15 @@ auto const propagators =
 #endif // EXTERNAL_FORCES
     };
 
+auto const verlet_cluster_sizes = std::vector<int>{1, 4};
+auto const verlet_inner_skins = std::vector<double>{0., 0.02};
+
 BOOST_DATA_TEST_CASE_F(ParticleFactory, verlet_list_update,
-                       bdata::make(node_grids) * bdata::make(propagators),
-                       node_grid, integration_helper) {
+                       bdata::make(node_grids) * bdata::make(propagators) *
+                           bdata::make(verlet_cluster_sizes) *
+                           bdata::make(verlet_inner_skins),
+                       node_grid, integration_helper, verlet_cluster_size,
+                       verlet_inner_skin) {
   auto constexpr tol = 8. * 100. * std::numeric_limits<double>::epsilon();
   auto const comm = boost::mpi::communicator();
   auto const rank = comm.rank();
@@ -174,6 +181,8 @@ BOOST_DATA_TEST_CASE_F(ParticleFactory, verlet_list_update,
   auto const box_l = 8.;
   espresso::system->set_box_l(Utils::Vector3d::broadcast(box_l));
   espresso::system->set_node_grid(node_grid);
+  ::cell_structure.set_verlet_cluster_size(verlet_cluster_size);
+  ::cell_structure.set_verlet_inner_skin(verlet_inner_skin);
 
   // particle properties
   auto const pid1 = 9;
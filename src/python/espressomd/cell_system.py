@@ -34,6 +34,24 @@ class CellSystem(ScriptInterfaceHelper):
         Whether to use Verlet lists.
     skin : :obj:`float`
         Verlet list skin.
+    verlet_cluster_size : :obj:`int`
+        Number of particles per cluster in the Verlet list. With 1, the
+        Verlet list stores particle pairs. With 4 or 8, particles are
+        grouped into spatially compact clusters and the Verlet list
+        stores cluster pairs, which are evaluated as dense tiles.
+    verlet_inner_skin : :obj:`float`
+        Skin of the inner pair list. With a positive value, the Verlet
+        list only serves as an outer list, from which the pairs within
+        the interaction range plus the inner skin are pruned whenever a
+        particle moved by more than half the inner skin. Only values
+        smaller than ``skin`` are useful. Defaults to 0 (no inner list).
+    use_mixed_precision : :obj:`bool`
+        Whether to evaluate the Lennard-Jones and WCA pair force factors
+        in single precision. Forces are still accumulated in double
+        precision. Defaults to ``False``.
+    cell_size_factor : :obj:`float`
+        Ratio between the minimal cell size of the regular decomposition
+        and the interaction range. Must be >= 1.
     node_grid : (3,) array_like of :obj:`int`
         MPI repartition for the regular decomposition cell system.
     max_cut_bonded : :obj:`float`
@@ -93,10 +111,42 @@ class CellSystem(ScriptInterfaceHelper):
         :obj:`dict` :
             The cell system state.
 
+    get_diagnostics()
+        Get statistics of the cell system and of the pair lists, summed
+        over all MPI ranks. The pair lists are not rebuilt: after a change
+        of the particles, the pair list entries are ``None`` until the next
+        force calculation, e.g. with ``system.integrator.run(0)``.
+
+        Returns
+        -------
+        :obj:`dict` :
+            The following keys:
+
+            * ``n_particles``: number of particles
+            * ``n_ghosts``: number of ghost particles
+            * ``n_cells``: number of cells
+            * ``cell_occupancy``: number of cells containing ``i``
+              particles at index ``i``
+            * ``n_pairs``: number of particle pairs in the Verlet list
+            * ``n_inner_pairs``: number of particle pairs in the inner
+              pair list (see :attr:`verlet_inner_skin`)
+            * ``n_cluster_pairs``: number of cluster pairs in the cluster
+              pair list (see :attr:`verlet_cluster_size`)
+            * ``n_pairs_beyond_cutoff``: number of particle pairs on which
+              the interactions are evaluated that are beyond the
+              interaction cutoffs
+            * ``n_prunes``: number of prunings of the inner pair list
+            * ``n_rebuilds``: number of particle resorts, i.e. of pair list
+              rebuilds, since the start of the simulation
+            * ``rebuild_reasons``: number of rebuilds triggered by particle
+              displacements, box changes, particle changes and cell system
+              changes; a rebuild can have several reasons
+
     """
     _so_name = "CellSystem::CellSystem"
     _so_creation_policy = "GLOBAL"
-    _so_bind_methods = ("get_state", "tune_skin", "resort")
+    _so_bind_methods = (
+        "get_state", "get_diagnostics", "tune_skin", "resort")
 
     def __reduce__(self):
         so_callback, so_callback_args = super().__reduce__()
@@ -151,6 +201,49 @@ class CellSystem(ScriptInterfaceHelper):
         """
         self.call_method("initialize", name="hybrid_decomposition", **kwargs)
 
+    def tune(self, int_steps,
+             decompositions=("regular_decomposition", "n_square"),
+             cell_size_factors=(1., 1.5, 2.), use_verlet_lists=(True, False),
+             skins=None, density_tolerance=0.):
+        """
+        Tune the cell system by measuring the integration time of every
+        combination of the candidate parameters. The fastest configuration
+        is set in the simulation core. The benchmark propagates the system.
+
+        Parameters
+        ----------
+        int_steps : :obj:`int`
+            Integration steps to time for each candidate.
+        decompositions : list of :obj:`str`, optional
+            Particle decompositions to test, among ``"regular_decomposition"``
+            and ``"n_square"``. Defaults to both.
+        cell_size_factors : list of :obj:`float`, optional
+            Values of :attr:`cell_size_factor` to test with the regular
+            decomposition. Defaults to ``(1., 1.5, 2.)``.
+        use_verlet_lists : list of :obj:`bool`, optional
+            Verlet list modes to test. Defaults to ``(True, False)``.
+        skins : list of :obj:`float`, optional
+            Skins to test. Defaults to the current :attr:`skin`.
+        density_tolerance : :obj:`float`, optional
+            If positive, the tuning is repeated at the start of an
+            integration when the particle number density has changed
+            by more than this relative amount since the last tuning.
+            Defaults to 0 (no automatic retuning).
+
+        Returns
+        -------
+        :obj:`dict` :
+            The cell system parameters.
+
+        """
+        if skins is None:
+            skins = [self.skin]
+        return self.call_method(
+            "tune", int_steps=int_steps, decompositions=list(decompositions),
+            cell_size_factors=list(cell_size_factors),
+            use_verlet_lists=list(use_verlet_lists), skins=list(skins),
+            density_tolerance=density_tolerance)
+
     def get_pairs(self, distance, types='all'):
         """
         Get pairs of particles closer than threshold value.
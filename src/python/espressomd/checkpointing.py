@@ -21,6 +21,7 @@ import inspect
 import os
 import re
 import signal
+import threading
 from . import utils
 
 try:
@@ -55,6 +56,8 @@ class Checkpoint:
 
         self.checkpoint_objects = []
         self.checkpoint_signals = []
+        self.__writer = None
+        self.__writer_error = None
         frm = inspect.stack()[1]
         self.calling_module = inspect.getmodule(frm[0])
 
@@ -191,12 +194,26 @@ class Checkpoint:
                 "No checkpoints found. Cannot return index for last checkpoint.")
         return self.counter - 1
 
-    def save(self, checkpoint_index=None):
+    def save(self, checkpoint_index=None, asynchronous=False):
         """
         Saves all registered python objects in the given checkpoint directory
         using cPickle.
 
+        Parameters
+        ----------
+        checkpoint_index : :obj:`int`, optional
+            If not given, the checkpoint counter will be used.
+        asynchronous : :obj:`bool`, optional
+            If ``True``, the registered objects are serialized in memory
+            and the checkpoint file is written by a background thread,
+            such that the simulation can continue while the data is
+            written to disk. Use :meth:`wait` to block until the file
+            is complete. Only one checkpoint can be written at a time:
+            a new call to :meth:`save` waits for the previous one.
+
         """
+        self.wait()
+
         # get attributes of registered objects
         checkpoint_data = collections.OrderedDict()
         for obj_name in self.checkpoint_objects:
@@ -208,11 +225,67 @@ class Checkpoint:
         filename = os.path.join(
             self.checkpoint_dir, f"{checkpoint_index}.checkpoint")
 
+        if not asynchronous:
+            self.__write_file(filename, pickle.dumps(checkpoint_data, -1))
+            return
+
+        # the objects can only be serialized from the main thread, since
+        # their state is collected from all MPI ranks
+        data = pickle.dumps(checkpoint_data, -1)
+        self.__writer = threading.Thread(
+            target=self.__write_file_background, args=(filename, data))
+        self.__writer.start()
+
+    def __write_file(self, filename, data):
+        """
+        Writes serialized data to a temporary file and renames it,
+        such that an incomplete checkpoint file is never visible.
+
+        """
         tmpname = filename + ".__tmp__"
         with open(tmpname, "wb") as checkpoint_file:
-            pickle.dump(checkpoint_data, checkpoint_file, -1)
+            checkpoint_file.write(data)
         os.rename(tmpname, filename)
 
+    def __write_file_background(self, filename, data):
+        """
+        Thread target of asynchronous checkpoints. Errors are stored and
+        raised by :meth:`wait` in the main thread.
+
+        """
+        try:
+            self.__write_file(filename, data)
+        except Exception as err:
+            self.__writer_error = err
+
+    def is_saving(self):
+        """
+        Check whether an asynchronous checkpoint is still being written.
+
+        Returns
+        -------
+        :obj:`bool`
+            ``True`` if the background thread hasn't finished yet.
+
+        """
+        return self.__writer is not None and self.__writer.is_alive()
+
+    def wait(self):
+        """
+        Block until the asynchronous checkpoint in flight, if any, is
+        written to disk. Raises the error that occurred while writing
+        the checkpoint file, if any.
+
+        """
+        if self.__writer is not None:
+            self.__writer.join()
+            self.__writer = None
+        if self.__writer_error is not None:
+            err = self.__writer_error
+            self.__writer_error = None
+            raise RuntimeError(
+                f"Failed to write checkpoint file: {err}") from err
+
     def load(self, checkpoint_index=None):
         """
         Loads the python objects using (c)Pickle and sets them in the calling
@@ -224,6 +297,7 @@ class Checkpoint:
             If not given, the last ``checkpoint_index`` will be used.
 
         """
+        self.wait()
         if checkpoint_index is None:
             checkpoint_index = self.get_last_checkpoint_index()
 
@@ -149,6 +149,11 @@ class _P3MBase(ElectrostaticInteraction):
                 "prefactor": 0.,
                 "check_neutrality": True,
                 "check_complex_residuals": True,
+                "kspace_ranks": 0,
+                "fft_decomposition": "auto",
+                "fftw_wisdom_file": "",
+                "retune_interval": 0,
+                "retune_tolerance": 2.,
                 "tune": True,
                 "timings": 10,
                 "verbose": True}
@@ -182,6 +187,14 @@ class _P3MBase(ElectrostaticInteraction):
             raise TypeError("Parameter 'timings' has to be an integer")
         if not utils.is_valid_type(params["tune"], bool):
             raise TypeError("Parameter 'tune' has to be a boolean")
+        if not utils.is_valid_type(params["kspace_ranks"], int):
+            raise TypeError("Parameter 'kspace_ranks' has to be an integer")
+        if not isinstance(params["fft_decomposition"], str):
+            raise TypeError("Parameter 'fft_decomposition' has to be a string")
+        if not isinstance(params["fftw_wisdom_file"], str):
+            raise TypeError("Parameter 'fftw_wisdom_file' has to be a string")
+        if not utils.is_valid_type(params["retune_interval"], int):
+            raise TypeError("Parameter 'retune_interval' has to be an integer")
 
 
 @script_interface_register
@@ -227,6 +240,32 @@ class P3M(_P3MBase):
     check_complex_residuals: :obj:`bool`, optional
         Raise a warning if the backward Fourier transform has non-zero
         complex residuals when set to ``True`` (default).
+    kspace_ranks : :obj:`int`, optional
+        Number of MPI ranks performing the FFT, which must divide the
+        number of MPI ranks. The other ranks only send their mesh and wait
+        for the result, which shortens the FFT all-to-all communication on
+        large rank counts. Use all ranks if 0 (default), or let the tuning
+        algorithm pick the fastest value if -1.
+    fft_decomposition : :obj:`str`, optional
+        Decomposition of the k-space mesh onto the FFT ranks, either
+        ``"slab"`` (one transpose between FFT ranks per transform, limited
+        to as many ranks as mesh planes), ``"pencil"`` (two transposes per
+        transform, scales to more ranks) or ``"auto"`` (default) to choose
+        slabs when each rank gets at least two mesh planes.
+    fftw_wisdom_file : :obj:`str`, optional
+        Path to a file from which FFTW wisdom is imported before tuning
+        and to which it is exported after tuning, to avoid expensive FFT
+        planning in subsequent simulations. Disabled when empty (default).
+    retune_interval : :obj:`int`, optional
+        Number of integration steps between two re-evaluations of the
+        error estimate with the current charges and box. When the error
+        estimate drifted away from the target accuracy by more than a
+        factor ``retune_tolerance``, e.g. after a volume change in the
+        NpT ensemble, ``alpha``, ``r_cut`` and, if needed, ``mesh`` are
+        adapted without restarting the simulation. Disabled if 0 (default).
+    retune_tolerance : :obj:`float`, optional
+        Tolerated ratio between the error estimate and the target
+        accuracy, must be larger than 1. Defaults to 2.
 
     """
     _so_name = "Coulomb::CoulombP3M"
@@ -280,6 +319,32 @@ class P3MGPU(_P3MBase):
     check_complex_residuals: :obj:`bool`, optional
         Raise a warning if the backward Fourier transform has non-zero
         complex residuals when set to ``True`` (default).
+    kspace_ranks : :obj:`int`, optional
+        Number of MPI ranks performing the FFT, which must divide the
+        number of MPI ranks. The other ranks only send their mesh and wait
+        for the result, which shortens the FFT all-to-all communication on
+        large rank counts. Use all ranks if 0 (default), or let the tuning
+        algorithm pick the fastest value if -1.
+    fft_decomposition : :obj:`str`, optional
+        Decomposition of the k-space mesh onto the FFT ranks, either
+        ``"slab"`` (one transpose between FFT ranks per transform, limited
+        to as many ranks as mesh planes), ``"pencil"`` (two transposes per
+        transform, scales to more ranks) or ``"auto"`` (default) to choose
+        slabs when each rank gets at least two mesh planes.
+    fftw_wisdom_file : :obj:`str`, optional
+        Path to a file from which FFTW wisdom is imported before tuning
+        and to which it is exported after tuning, to avoid expensive FFT
+        planning in subsequent simulations. Disabled when empty (default).
+    retune_interval : :obj:`int`, optional
+        Number of integration steps between two re-evaluations of the
+        error estimate with the current charges and box. When the error
+        estimate drifted away from the target accuracy by more than a
+        factor ``retune_tolerance``, e.g. after a volume change in the
+        NpT ensemble, ``alpha``, ``r_cut`` and, if needed, ``mesh`` are
+        adapted without restarting the simulation. Disabled if 0 (default).
+    retune_tolerance : :obj:`float`, optional
+        Tolerated ratio between the error estimate and the target
+        accuracy, must be larger than 1. Defaults to 2.
 
     """
     _so_name = "Coulomb::CoulombP3MGPU"
@@ -449,6 +514,100 @@ class MMM1DGPU(ElectrostaticInteraction):
         return {"prefactor", "maxPWerror"}
 
 
+@script_interface_register
+class RBE(ElectrostaticInteraction):
+    """
+    Random Batch Ewald electrostatics solver.
+    See :ref:`Random Batch Ewald` for more details.
+
+    Parameters
+    ----------
+    prefactor : :obj:`float`
+        Electrostatics prefactor (see :eq:`coulomb_prefactor`).
+    alpha : :obj:`float`
+        Ewald splitting parameter.
+    r_cut : :obj:`float`
+        Real space cutoff.
+    seed : :obj:`int`
+        Seed of the random number generator that samples the wave vectors.
+    batch_size : :obj:`int`, optional
+        Number of wave vectors sampled per force calculation.
+    check_neutrality : :obj:`bool`, optional
+        Raise a warning if the system is not electrically neutral when
+        set to ``True`` (default).
+
+    """
+    _so_name = "Coulomb::CoulombRBE"
+    _so_creation_policy = "GLOBAL"
+
+    def required_keys(self):
+        return {"prefactor", "alpha", "r_cut", "seed"}
+
+    def default_params(self):
+        return {"batch_size": 100,
+                "check_neutrality": True}
+
+    def validate_params(self, params):
+        super().validate_params(params)
+        utils.check_type_or_throw_except(
+            params["alpha"], 1, float, "Parameter 'alpha' has to be a float")
+        utils.check_type_or_throw_except(
+            params["r_cut"], 1, float, "Parameter 'r_cut' has to be a float")
+        if not utils.is_valid_type(params["batch_size"], int):
+            raise TypeError("Parameter 'batch_size' has to be an integer")
+        if not utils.is_valid_type(params["seed"], int):
+            raise TypeError("Parameter 'seed' has to be an integer")
+
+
+@script_interface_register
+class FMM(ElectrostaticInteraction):
+    """
+    Fast multipole method electrostatics solver for open boundaries.
+    See :ref:`Fast multipole method` for more details.
+
+    Parameters
+    ----------
+    prefactor : :obj:`float`
+        Electrostatics prefactor (see :eq:`coulomb_prefactor`).
+    accuracy : :obj:`float`
+        Relative RMS force error used to tune the expansion order.
+    order : :obj:`int`, optional
+        Order of the multipole expansions. Tuned if not provided.
+    theta : :obj:`float`, optional
+        Opening angle of the multipole acceptance criterion.
+    leaf_size : :obj:`int`, optional
+        Largest number of charges in a leaf cell of the octree.
+    check_neutrality : :obj:`bool`, optional
+        Raise a warning if the system is not electrically neutral when
+        set to ``True``. Defaults to ``False``, since a net charge is
+        well-defined for open boundaries.
+
+    """
+    _so_name = "Coulomb::CoulombFMM"
+    _so_creation_policy = "GLOBAL"
+
+    def required_keys(self):
+        return {"prefactor", "accuracy"}
+
+    def default_params(self):
+        return {"order": -1,
+                "theta": 0.5,
+                "leaf_size": 64,
+                "check_neutrality": False}
+
+    def validate_params(self, params):
+        super().validate_params(params)
+        utils.check_type_or_throw_except(
+            params["accuracy"], 1, float,
+            "Parameter 'accuracy' has to be a float")
+        utils.check_type_or_throw_except(
+            params["theta"], 1, float, "Parameter 'theta' has to be a float")
+        if not utils.is_valid_type(params["order"], int):
+            raise TypeError("Parameter 'order' has to be an integer")
+        if not utils.is_valid_type(params["leaf_size"], int):
+            raise TypeError("Parameter 'leaf_size' has to be an integer")
+
+
 @script_interface_register
 class Scafacos(ElectrostaticInteraction):
 
@@ -26,6 +26,12 @@ class IntegratorHandle(ScriptInterfaceHelper):
     """
     Provide access to the currently active integrator.
 
+    Attributes
+    ----------
+    adaptive_time_step : :class:`AdaptiveTimeStep` or ``None``
+        Adaptive time step control of the integrator, or ``None`` to use
+        a constant time step.
+
     """
     _so_name = "Integrators::IntegratorHandle"
     _so_creation_policy = "GLOBAL"
@@ -84,6 +90,14 @@ class IntegratorHandle(ScriptInterfaceHelper):
         """
         self.integrator = BrownianDynamics()
 
+    def set_baoab(self):
+        """
+        Set the integration method to the BAOAB Langevin splitting scheme
+        (:class:`BAOABLangevin`).
+
+        """
+        self.integrator = BAOABLangevin()
+
     def set_stokesian_dynamics(self, **kwargs):
         """
         Set the integration method to Stokesian Dynamics (:class:`StokesianDynamics`).
@@ -92,6 +106,32 @@ class IntegratorHandle(ScriptInterfaceHelper):
         self.integrator = StokesianDynamics(**kwargs)
 
 
+@script_interface_register
+class AdaptiveTimeStep(ScriptInterfaceHelper):
+    """
+    Adaptive time step control for the velocity Verlet and BAOAB integrators.
+    Before each integration step, the time step is chosen such that no
+    particle travels further than ``max_displacement``, as estimated from
+    its velocity and acceleration. The time step is reduced immediately,
+    but grows by at most a factor ``max_growth`` per step. The current time
+    step can be read from :attr:`espressomd.system.System.time_step`.
+
+    Parameters
+    ----------
+    max_displacement : :obj:`float`
+        Maximal particle displacement per integration step.
+    time_step_min : :obj:`float`
+        Lower bound of the time step.
+    time_step_max : :obj:`float`
+        Upper bound of the time step.
+    max_growth : :obj:`float`, optional
+        Maximal ratio of two consecutive time steps. Default is 1.05.
+
+    """
+    _so_name = "Integrators::AdaptiveTimeStep"
+    _so_creation_policy = "GLOBAL"
+
+
 class Integrator(ScriptInterfaceHelper):
     """
     Integrator class.
@@ -225,6 +265,21 @@ class BrownianDynamics(Integrator):
     _so_creation_policy = "GLOBAL"
 
 
+@script_interface_register
+class BAOABLangevin(Integrator):
+    """
+    BAOAB Langevin integrator, suitable for configurational sampling in the
+    NVT ensemble. The friction and noise of the Langevin thermostat are
+    applied to the particle velocities by the exact solution of the
+    Ornstein-Uhlenbeck process between two half-drifts, instead of being
+    added to the forces. The thermostat is activated with
+    :meth:`espressomd.thermostat.Thermostat.set_langevin`.
+
+    """
+    _so_name = "Integrators::BAOABLangevin"
+    _so_creation_policy = "GLOBAL"
+
+
 @script_interface_register
 class StokesianDynamics(Integrator):
     """
@@ -0,0 +1,107 @@
+#
+# Copyright (C) 2022 The ESPResSo project
+#
+# This file is part of ESPResSo.
+#
+# ESPResSo is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ESPResSo is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+import pathlib
+
+from ...script_interface import script_interface_register, ScriptInterfaceHelper  # pylint: disable=import
+from ...code_features import assert_features
+from ... import utils
+
+
+@script_interface_register
+class H5md(ScriptInterfaceHelper):
+
+    """
+    Parallel reader for H5MD files written by
+    :class:`espressomd.io.writer.h5md.H5md`.
+
+    Each MPI rank reads a contiguous slice of the particles of a frame,
+    which are then sent to the ranks that own their positions and
+    inserted in bulk. This makes the frames of a trajectory usable as
+    restart points.
+
+    Parameters
+    ----------
+    file_path : :obj:`str`
+        Path to the trajectory file.
+
+    Methods
+    -------
+    get_params()
+        Get the parameters from the script interface.
+
+    Attributes
+    ----------
+    file_path: :obj:`str`
+        Path to the trajectory file.
+    n_frames: :obj:`int`
+        Number of frames stored in the trajectory file.
+
+    """
+    _so_name = "ScriptInterface::Reader::H5md"
+    _so_creation_policy = "GLOBAL"
+
+    def __init__(self, **kwargs):
+        assert_features("H5MD")
+
+        if "sip" in kwargs:
+            super().__init__(**kwargs)
+            return
+
+        utils.check_type_or_throw_except(
+            kwargs.get("file_path"), 1, str, "'file_path' should be a string")
+        file_path = str(pathlib.Path(kwargs["file_path"]).resolve())
+        super().__init__(file_path=file_path)
+
+    def read_frame(self, frame=-1, bond=None):
+        """
+        Replace the particles of the system by the particles of a frame.
+
+        The box length, the simulation time and the Lees-Edwards state
+        (offset, shear direction and shear plane normal) are restored
+        if they were written to the file. The particle positions, images,
+        velocities, types, masses and charges are restored if they were
+        written to the file. Forces are recomputed at the next integration.
+
+        Parameters
+        ----------
+        frame : :obj:`int`, optional
+            Index of the frame. Negative values count from the end,
+            by default the last frame is read.
+        bond : :class:`espressomd.interactions.BondedInteraction`, optional
+            The connectivity table of H5MD files only stores the particle
+            ids of pair bonds. When given, the bonds of the frame are
+            restored with this bonded interaction, otherwise they are
+            ignored.
+
+        Returns
+        -------
+        :obj:`dict`
+            The ``time`` and ``step`` of the frame.
+
+        """
+        utils.check_type_or_throw_except(
+            frame, 1, int, "'frame' should be an integer")
+        bond_id = -1
+        if bond is not None:
+            if bond._bond_id == -1:
+                raise Exception(
+                    "The bonded interaction has not yet been added to the list of active bonds in ESPResSo")
+            bond_id = bond._bond_id
+        return self.call_method("read_frame", frame=frame, bond_id=bond_id)
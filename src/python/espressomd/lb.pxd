@@ -82,6 +82,9 @@ cdef extern from "grid_based_algorithms/lb_interface.hpp":
     Vector6d lb_lbfluid_get_pressure_tensor() except +
     bool lb_lbnode_is_index_valid(const Vector3i & ind) except +
     Vector3i lb_lbfluid_get_shape() except +
+    void lb_lbfluid_add_refinement_region(const Vector3i & lower, const Vector3i & upper) except +
+    void lb_lbfluid_clear_refinement_regions() except +
+    vector[Vector3i] lb_lbfluid_get_refinement_regions() except +
     const Vector3d lb_lbnode_get_velocity(const Vector3i & ind) except +
     void lb_lbnode_set_velocity(const Vector3i & ind, const Vector3d & u) except +
     double lb_lbnode_get_density(const Vector3i & ind) except +
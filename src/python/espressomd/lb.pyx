@@ -555,6 +555,50 @@ cdef class LBFluid(HydrodynamicInteraction):
         self._set_lattice_switch()
         self._set_params_in_es_core()
 
+    def _deactivate_method(self):
+        lb_lbfluid_clear_refinement_regions()
+        HydrodynamicInteraction._deactivate_method(self)
+
+    def add_refinement_region(self, lower, upper):
+        """Refine a cuboid region of the lattice by a factor 2.
+
+        The region is covered by a lattice with half the lattice constant,
+        which is integrated with two time steps of half the LB time step
+        per LB time step. Particles inside the region couple to the fine
+        lattice. The fluid in the region is initialized from the coarse
+        lattice. Only available on a single MPI rank.
+
+        Parameters
+        ----------
+        lower : (3,) array_like of :obj:`int`
+            Node indices of the lower corner of the region.
+        upper : (3,) array_like of :obj:`int`
+            Node indices of the upper corner of the region. The region
+            must span at least 4 lattice cells in each direction.
+
+        """
+        utils.check_type_or_throw_except(
+            lower, 3, int, "lower has to be an integer list of length 3")
+        utils.check_type_or_throw_except(
+            upper, 3, int, "upper has to be an integer list of length 3")
+        lb_lbfluid_add_refinement_region(
+            utils.make_Vector3i(lower), utils.make_Vector3i(upper))
+        utils.handle_errors("LB grid refinement")
+
+    def clear_refinement_regions(self):
+        """Remove all refined regions."""
+        lb_lbfluid_clear_refinement_regions()
+
+    property refinement_regions:
+        def __get__(self):
+            cdef vector[Vector3i] corners = lb_lbfluid_get_refinement_regions()
+            regions = []
+            for i in range(0, corners.size(), 2):
+                regions.append(
+                    ((corners[i][0], corners[i][1], corners[i][2]),
+                     (corners[i + 1][0], corners[i + 1][1], corners[i + 1][2])))
+            return regions
+
 IF CUDA:
     cdef class LBFluidGPU(HydrodynamicInteraction):
         """
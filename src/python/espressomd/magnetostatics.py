@@ -113,6 +113,32 @@ class DipolarP3M(MagnetostaticInteraction):
         (default is ``True``, i.e., activated).
     timings : :obj:`int`
         Number of force calculations during tuning.
+    kspace_ranks : :obj:`int`, optional
+        Number of MPI ranks performing the FFT, which must divide the
+        number of MPI ranks. The other ranks only send their mesh and wait
+        for the result, which shortens the FFT all-to-all communication on
+        large rank counts. Use all ranks if 0 (default), or let the tuning
+        algorithm pick the fastest value if -1.
+    fft_decomposition : :obj:`str`, optional
+        Decomposition of the k-space mesh onto the FFT ranks, either
+        ``"slab"`` (one transpose between FFT ranks per transform, limited
+        to as many ranks as mesh planes), ``"pencil"`` (two transposes per
+        transform, scales to more ranks) or ``"auto"`` (default) to choose
+        slabs when each rank gets at least two mesh planes.
+    fftw_wisdom_file : :obj:`str`, optional
+        Path to a file from which FFTW wisdom is imported before tuning
+        and to which it is exported after tuning, to avoid expensive FFT
+        planning in subsequent simulations. Disabled when empty (default).
+    retune_interval : :obj:`int`, optional
+        Number of integration steps between two re-evaluations of the
+        error estimate with the current dipoles and box. When the error
+        estimate drifted away from the target accuracy by more than a
+        factor ``retune_tolerance``, e.g. after a volume change in the
+        NpT ensemble, ``alpha``, ``r_cut`` and, if needed, ``mesh`` are
+        adapted without restarting the simulation. Disabled if 0 (default).
+    retune_tolerance : :obj:`float`, optional
+        Tolerated ratio between the error estimate and the target
+        accuracy, must be larger than 1. Defaults to 2.
 
     """
     _so_name = "Dipoles::DipolarP3M"
@@ -149,6 +175,14 @@ class DipolarP3M(MagnetostaticInteraction):
             raise TypeError("Parameter 'timings' has to be an integer")
         if not utils.is_valid_type(params["tune"], bool):
             raise TypeError("Parameter 'tune' has to be a boolean")
+        if not utils.is_valid_type(params["kspace_ranks"], int):
+            raise TypeError("Parameter 'kspace_ranks' has to be an integer")
+        if not isinstance(params["fft_decomposition"], str):
+            raise TypeError("Parameter 'fft_decomposition' has to be a string")
+        if not isinstance(params["fftw_wisdom_file"], str):
+            raise TypeError("Parameter 'fftw_wisdom_file' has to be a string")
+        if not utils.is_valid_type(params["retune_interval"], int):
+            raise TypeError("Parameter 'retune_interval' has to be an integer")
 
     def required_keys(self):
         return {"accuracy"}
@@ -164,6 +198,11 @@ class DipolarP3M(MagnetostaticInteraction):
                 "prefactor": 0.,
                 "tune": True,
                 "timings": 10,
+                "kspace_ranks": 0,
+                "fft_decomposition": "auto",
+                "fftw_wisdom_file": "",
+                "retune_interval": 0,
+                "retune_tolerance": 2.,
                 "verbose": True}
 
 
@@ -184,12 +223,17 @@ class DipolarDirectSumCpu(MagnetostaticInteraction):
         Magnetostatics prefactor (:math:`\\mu_0/(4\\pi)`)
     n_replicas : :obj:`int`, optional
         Number of replicas to be taken into account at periodic boundaries.
+    n_table : :obj:`int`, optional
+        Number of grid cells per direction of the tabulated lattice sum
+        over the replicas. Requires ``n_replicas > 0`` and periodicity
+        in all directions. When 0 (default), the replicas are summed
+        explicitly.
 
     """
     _so_name = "Dipoles::DipolarDirectSumCpu"
 
     def default_params(self):
-        return {"n_replicas": 0}
+        return {"n_replicas": 0, "n_table": 0}
 
     def required_keys(self):
         return {"prefactor"}
@@ -83,6 +83,13 @@ class ReactionAlgorithm(ScriptInterfaceHelper):
         ``"parallel"`` method is faster. The ``"parallel"`` method is not
         recommended for simulations on 1 MPI rank, since it comes with the
         overhead of a ghost particle update.
+    number_of_trial_positions : :obj:`int`, optional
+        Number of random trial positions of each created particle. Default
+        is 1, which places created particles uniformly in the box. With more
+        trial positions, the configurational-bias Monte Carlo scheme selects
+        one position with a probability given by the Boltzmann factor of the
+        short-range energy of the particle, and deleted particles are weighted
+        accordingly. The acceptance probability is corrected for this bias.
 
     Methods
     -------
@@ -287,7 +294,8 @@ class ReactionAlgorithm(ScriptInterfaceHelper):
 
     def valid_keys(self):
         return {"kT", "exclusion_range", "seed",
-                "exclusion_radius_per_type", "search_algorithm"}
+                "exclusion_radius_per_type", "search_algorithm",
+                "number_of_trial_positions"}
 
     def required_keys(self):
         return {"kT", "exclusion_range", "seed"}
@@ -541,7 +549,8 @@ class ConstantpHEnsemble(ReactionAlgorithm):
 
     def valid_keys(self):
         return {"kT", "exclusion_range", "seed",
-                "constant_pH", "exclusion_radius_per_type", "search_algorithm"}
+                "constant_pH", "exclusion_radius_per_type", "search_algorithm",
+                "number_of_trial_positions"}
 
     def required_keys(self):
         return {"kT", "exclusion_range", "seed", "constant_pH"}
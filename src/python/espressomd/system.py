@@ -136,6 +136,23 @@ class System(ScriptInterfaceHelper):
             If the particle ``type`` is not currently tracked by the system.
             To select which particle types are tracked, call :meth:`setup_type_map`.
 
+    memory_usage()
+        Heap memory held by the simulation subsystems. The memory is
+        accounted per MPI rank and aggregated over all ranks. The bond
+        and exclusion lists are included in the particle memory. Only
+        the accumulators registered in :attr:`auto_update_accumulators`
+        are accounted for.
+
+        Returns
+        -------
+        :obj:`dict`
+            Memory usage in bytes, as a dictionary with keys ``"min"``,
+            ``"max"`` and ``"sum"`` over the MPI ranks, for each of the
+            subsystems ``"local_particles"``, ``"ghost_particles"``,
+            ``"pair_lists"``, ``"particle_index"``, ``"type_map"``,
+            ``"lb_fluid"``, ``"p3m"``, ``"dp3m"``, ``"fetch_cache"``,
+            ``"accumulators"`` and for their ``"total"``.
+
     rotate_system()
         Rotate the particles in the system about the center of mass.
 
@@ -157,6 +174,7 @@ class System(ScriptInterfaceHelper):
     _so_bind_methods = (
         "setup_type_map",
         "number_of_particles",
+        "memory_usage",
         "rotate_system")
 
     def __getattr__(self, attr):
@@ -39,6 +39,7 @@
 #include <boost/variant.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <set>
 #include <sstream>
@@ -64,6 +65,12 @@ static auto const &get_hybrid_decomposition() {
 CellSystem::CellSystem() {
   add_parameters({
       {"use_verlet_lists", ::cell_structure.use_verlet_list},
+      {"use_mixed_precision",
+       [](Variant const &v) {
+         ::cell_structure.use_mixed_precision = get_value<bool>(v);
+         ::recalc_forces = true;
+       },
+       []() { return ::cell_structure.use_mixed_precision; }},
       {"node_grid",
        [this](Variant const &v) {
          context()->parallel_try_catch([&v]() {
@@ -99,6 +106,34 @@ CellSystem::CellSystem() {
          ::set_skin(new_skin);
        },
        []() { return ::skin; }},
+      {"verlet_cluster_size",
+       [this](Variant const &v) {
+         auto const size = get_value<int>(v);
+         context()->parallel_try_catch(
+             [size]() { ::cell_structure.set_verlet_cluster_size(size); });
+       },
+       []() { return ::cell_structure.get_verlet_cluster_size(); }},
+      {"verlet_inner_skin",
+       [this](Variant const &v) {
+         auto const inner_skin = get_value<double>(v);
+         context()->parallel_try_catch([inner_skin]() {
+           ::cell_structure.set_verlet_inner_skin(inner_skin);
+         });
+       },
+       []() { return ::cell_structure.get_verlet_inner_skin(); }},
+      {"cell_size_factor",
+       [this](Variant const &v) {
+         auto const factor = get_value<double>(v);
+         context()->parallel_try_catch([factor]() {
+           if (factor < 1.) {
+             throw std::domain_error(
+                 "Parameter 'cell_size_factor' must be >= 1");
+           }
+         });
+         ::cell_structure.cell_size_factor = factor;
+         cells_re_init(::cell_structure.decomposition_type());
+       },
+       []() { return ::cell_structure.cell_size_factor; }},
       {"decomposition_type", AutoParameter::read_only,
        [this]() {
          return cs_type_to_name.at(::cell_structure.decomposition_type());
@@ -161,6 +196,39 @@ Variant CellSystem::do_call_method(std::string const &name,
     state["n_nodes"] = context()->get_comm().size();
     return state;
   }
+  if (name == "get_diagnostics") {
+    auto const diagnostics = get_cell_system_diagnostics();
+    auto const to_int = [](std::size_t value) {
+      return static_cast<int>(value);
+    };
+    std::vector<int> cell_occupancy;
+    std::transform(diagnostics.cell_occupancy.begin(),
+                   diagnostics.cell_occupancy.end(),
+                   std::back_inserter(cell_occupancy), to_int);
+    auto const pair_list = [&diagnostics](std::size_t value) {
+      return diagnostics.pair_lists_valid ? Variant{static_cast<int>(value)}
+                                          : Variant{none};
+    };
+    return VariantMap{
+        {"n_particles", to_int(diagnostics.n_particles)},
+        {"n_ghosts", to_int(diagnostics.n_ghosts)},
+        {"n_cells", to_int(diagnostics.n_cells)},
+        {"cell_occupancy", cell_occupancy},
+        {"n_pairs", pair_list(diagnostics.n_pairs)},
+        {"n_inner_pairs", pair_list(diagnostics.n_inner_pairs)},
+        {"n_cluster_pairs", pair_list(diagnostics.n_cluster_pairs)},
+        {"n_pairs_beyond_cutoff", pair_list(diagnostics.n_pairs_beyond_cutoff)},
+        {"n_prunes", to_int(diagnostics.n_prunes)},
+        {"n_rebuilds", to_int(diagnostics.n_rebuilds)},
+        {"rebuild_reasons",
+         VariantMap{
+             {"displacement", to_int(diagnostics.n_rebuilds_displacement)},
+             {"box_change", to_int(diagnostics.n_rebuilds_box_change)},
+             {"particle_change",
+              to_int(diagnostics.n_rebuilds_particle_change)},
+             {"cell_system_change",
+              to_int(diagnostics.n_rebuilds_cell_system_change)}}}};
+  }
   if (name == "get_pairs") {
     on_observable_calc();
     std::vector<Variant> out;
@@ -230,6 +298,42 @@ Variant CellSystem::do_call_method(std::string const &name,
               get_value_or<bool>(params, "adjust_max_skin", false));
     return ::skin;
   }
+  if (name == "tune") {
+    context()->parallel_try_catch([this, &params]() {
+      CellSystemTuningParameters tuning_params;
+      auto const names =
+          get_value<std::vector<std::string>>(params, "decompositions");
+      for (auto const &cs_name : names) {
+        if (cs_name_to_type.count(cs_name) == 0) {
+          throw std::invalid_argument("Unknown decomposition '" + cs_name +
+                                      "'");
+        }
+        tuning_params.decompositions.emplace_back(cs_name_to_type.at(cs_name));
+      }
+      tuning_params.cell_size_factors =
+          get_value<std::vector<double>>(params, "cell_size_factors");
+      for (auto const factor : tuning_params.cell_size_factors) {
+        if (factor < 1.) {
+          throw std::domain_error("Parameter 'cell_size_factors' must be >= 1");
+        }
+      }
+      for (auto const &flag :
+           get_value<std::vector<Variant>>(params, "use_verlet_lists")) {
+        tuning_params.use_verlet_lists.emplace_back(get_value<bool>(flag));
+      }
+      tuning_params.skins = get_value<std::vector<double>>(params, "skins");
+      for (auto const skin : tuning_params.skins) {
+        if (skin < 0.) {
+          throw std::domain_error("Parameter 'skins' must be >= 0");
+        }
+      }
+      tuning_params.int_steps = get_value<int>(params, "int_steps");
+      tuning_params.density_tolerance =
+          get_value_or<double>(params, "density_tolerance", 0.);
+      tune_cell_system(tuning_params);
+    });
+    return get_parameters();
+  }
   if (name == "get_max_range") {
     return ::cell_structure.max_range();
   }
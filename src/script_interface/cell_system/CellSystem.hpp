@@ -55,6 +55,20 @@ public:
       auto const cs_name = get_value<std::string>(params, "decomposition_type");
       auto const cs_type = cs_name_to_type.at(cs_name);
       initialize(cs_type, params);
+      if (params.count("cell_size_factor")) {
+        do_set_parameter("cell_size_factor", params.at("cell_size_factor"));
+      }
+      if (params.count("use_mixed_precision")) {
+        do_set_parameter("use_mixed_precision",
+                         params.at("use_mixed_precision"));
+      }
+      if (params.count("verlet_cluster_size")) {
+        do_set_parameter("verlet_cluster_size",
+                         params.at("verlet_cluster_size"));
+      }
+      if (params.count("verlet_inner_skin")) {
+        do_set_parameter("verlet_inner_skin", params.at("verlet_inner_skin"));
+      }
       do_set_parameter("skin", params.at("skin"));
       do_set_parameter("node_grid", params.at("node_grid"));
     }
@@ -71,12 +71,27 @@ public:
         {"tune", AutoParameter::read_only, [this]() { return m_tune; }},
         {"check_complex_residuals", AutoParameter::read_only,
          [this]() { return actor()->check_complex_residuals; }},
+        {"kspace_ranks", AutoParameter::read_only,
+         [this]() { return actor()->p3m.params.kspace_ranks; }},
+        {"fft_decomposition", AutoParameter::read_only,
+         [this]() {
+           auto const &params = actor()->p3m.params;
+           return fft_decomposition_name(params.fft_decomposition);
+         }},
+        {"fftw_wisdom_file", AutoParameter::read_only,
+         [this]() { return actor()->fftw_wisdom_file; }},
+        {"retune_interval", AutoParameter::read_only,
+         [this]() { return actor()->retune_interval; }},
+        {"retune_tolerance", AutoParameter::read_only,
+         [this]() { return actor()->retune_tolerance; }},
     });
   }
 
   void do_construct(VariantMap const &params) override {
     m_tune = get_value<bool>(params, "tune");
     context()->parallel_try_catch([&]() {
+      auto const fft_decomposition = fft_decomposition_from_name(
+          get_value<std::string>(params, "fft_decomposition"));
       auto p3m = P3MParameters{!get_value_or<bool>(params, "is_tuned", !m_tune),
                                get_value<double>(params, "epsilon"),
                                get_value<double>(params, "r_cut"),
@@ -84,11 +99,16 @@ public:
                                get_value<Utils::Vector3d>(params, "mesh_off"),
                                get_value<int>(params, "cao"),
                                get_value<double>(params, "alpha"),
-                               get_value<double>(params, "accuracy")};
+                               get_value<double>(params, "accuracy"),
+                               get_value<int>(params, "kspace_ranks"),
+                               fft_decomposition};
       m_actor = std::make_shared<CoreActorClass>(
           std::move(p3m), get_value<double>(params, "prefactor"),
           get_value<int>(params, "timings"), get_value<bool>(params, "verbose"),
-          get_value<bool>(params, "check_complex_residuals"));
+          get_value<bool>(params, "check_complex_residuals"),
+          get_value<std::string>(params, "fftw_wisdom_file"),
+          get_value<int>(params, "retune_interval"),
+          get_value<double>(params, "retune_tolerance"));
     });
     set_charge_neutrality_tolerance(params);
   }
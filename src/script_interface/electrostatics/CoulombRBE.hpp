@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ESPRESSO_SRC_SCRIPT_INTERFACE_ELECTROSTATICS_RBE_HPP
+#define ESPRESSO_SRC_SCRIPT_INTERFACE_ELECTROSTATICS_RBE_HPP
+
+#include "config/config.hpp"
+
+#ifdef ELECTROSTATICS
+
+#include "Actor.hpp"
+
+#include "core/electrostatics/rbe.hpp"
+
+#include "script_interface/get_value.hpp"
+
+#include <memory>
+#include <string>
+
+namespace ScriptInterface {
+namespace Coulomb {
+
+class CoulombRBE : public Actor<CoulombRBE, ::CoulombRBE> {
+
+public:
+  CoulombRBE() {
+    add_parameters({
+        {"alpha", AutoParameter::read_only,
+         [this]() { return actor()->alpha; }},
+        {"r_cut", AutoParameter::read_only,
+         [this]() { return actor()->r_cut; }},
+        {"batch_size", AutoParameter::read_only,
+         [this]() { return actor()->batch_size; }},
+        {"seed", AutoParameter::read_only,
+         [this]() { return static_cast<int>(actor()->seed); }},
+    });
+  }
+
+  void do_construct(VariantMap const &params) override {
+    context()->parallel_try_catch([this, &params]() {
+      m_actor = std::make_shared<CoreActorClass>(
+          get_value<double>(params, "prefactor"),
+          get_value<double>(params, "alpha"),
+          get_value<double>(params, "r_cut"),
+          get_value<int>(params, "batch_size"),
+          get_value<int>(params, "seed"));
+    });
+    set_charge_neutrality_tolerance(params);
+  }
+};
+
+} // namespace Coulomb
+} // namespace ScriptInterface
+
+#endif // ELECTROSTATICS
+#endif
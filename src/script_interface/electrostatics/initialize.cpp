@@ -25,10 +25,12 @@
 
 #include "Actor_impl.hpp"
 
+#include "CoulombFMM.hpp"
 #include "CoulombMMM1D.hpp"
 #include "CoulombMMM1DGpu.hpp"
 #include "CoulombP3M.hpp"
 #include "CoulombP3MGPU.hpp"
+#include "CoulombRBE.hpp"
 #include "CoulombScafacos.hpp"
 #include "DebyeHueckel.hpp"
 #include "ElectrostaticLayerCorrection.hpp"
@@ -63,6 +65,8 @@ void initialize(Utils::Factory<ObjectHandle> *om) {
   om->register_new<CoulombMMM1DGpu>("Coulomb::CoulombMMM1DGpu");
 #endif
   om->register_new<CoulombMMM1D>("Coulomb::CoulombMMM1D");
+  om->register_new<CoulombRBE>("Coulomb::CoulombRBE");
+  om->register_new<CoulombFMM>("Coulomb::CoulombFMM");
 #ifdef SCAFACOS
   om->register_new<CoulombScafacos>("Coulomb::CoulombScafacos");
 #endif
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config/config.hpp"
+
+#ifdef H5MD
+
+#include "h5md_reader.hpp"
+
+#include "core/bonded_interactions/bonded_interaction_data.hpp"
+#include "core/grid.hpp"
+#include "core/integrate.hpp"
+#include "core/particle_node.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace ScriptInterface {
+namespace Reader {
+
+Variant H5md::do_call_method(const std::string &name,
+                             const VariantMap &parameters) {
+  if (name == "read_frame") {
+    ::Reader::H5md::Frame frame{};
+    context()->parallel_try_catch([&]() {
+      auto const bond_id = get_value<int>(parameters, "bond_id");
+      if (bond_id != -1 and
+          (not bonded_ia_params.contains(bond_id) or
+           number_of_partners(*bonded_ia_params.at(bond_id)) != 1)) {
+        throw std::invalid_argument(
+            "Parameter 'bond' must be a registered pair bond");
+      }
+      frame = m_h5md->read_frame(get_value<int>(parameters, "frame"), bond_id);
+    });
+    remove_all_particles();
+    if (frame.box_l) {
+      set_box_length(*frame.box_l);
+    }
+    set_time(frame.time);
+    if (frame.lees_edwards_bc) {
+      auto lebc = *frame.lees_edwards_bc;
+      lebc.shear_velocity = box_geo.lees_edwards_bc().shear_velocity;
+      box_geo.set_lees_edwards_bc(lebc);
+    }
+    make_new_particles(std::move(frame.particles));
+    return VariantMap{{"time", frame.time}, {"step", frame.step}};
+  }
+  return {};
+}
+
+} // namespace Reader
+} // namespace ScriptInterface
+
+#endif // H5MD
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ESPRESSO_SRC_SCRIPT_INTERFACE_H5MD_H5MD_READER_HPP
+#define ESPRESSO_SRC_SCRIPT_INTERFACE_H5MD_H5MD_READER_HPP
+
+#include "config/config.hpp"
+
+#ifdef H5MD
+
+#include "io/reader/h5md_reader.hpp"
+
+#include "script_interface/ScriptInterface.hpp"
+#include "script_interface/auto_parameters/AutoParameters.hpp"
+
+#include <memory>
+#include <string>
+
+namespace ScriptInterface {
+namespace Reader {
+
+class H5md : public AutoParameters<H5md> {
+public:
+  H5md() {
+    add_parameters(
+        {{"file_path", m_h5md, &::Reader::H5md::File::file_path},
+         {"n_frames", AutoParameter::read_only,
+          [this]() { return m_h5md->n_frames(); }}});
+  };
+
+private:
+  Variant do_call_method(const std::string &name,
+                         const VariantMap &parameters) override;
+
+  void do_construct(VariantMap const &params) override {
+    context()->parallel_try_catch([&]() {
+      m_h5md = std::make_shared<::Reader::H5md::File>(
+          get_value<std::string>(params, "file_path"));
+    });
+  }
+
+  std::shared_ptr<::Reader::H5md::File> m_h5md;
+};
+
+} // namespace Reader
+} // namespace ScriptInterface
+
+#endif // H5MD
+#endif
@@ -20,12 +20,14 @@
 #include "config/config.hpp"
 #ifdef H5MD
 #include "h5md.hpp"
+#include "h5md_reader.hpp"
 #include "initialize.hpp"
 
 namespace ScriptInterface {
 namespace Writer {
 void initialize(Utils::Factory<ObjectHandle> *om) {
   om->register_new<H5md>("ScriptInterface::Writer::H5md");
+  om->register_new<Reader::H5md>("ScriptInterface::Reader::H5md");
 }
 } /* namespace Writer */
 } /* namespace ScriptInterface */
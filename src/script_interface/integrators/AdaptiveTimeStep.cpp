@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AdaptiveTimeStep.hpp"
+
+#include "script_interface/ScriptInterface.hpp"
+
+#include "core/integrators/adaptive_time_step.hpp"
+
+#include <memory>
+
+namespace ScriptInterface {
+namespace Integrators {
+
+AdaptiveTimeStep::AdaptiveTimeStep() {
+  add_parameters({
+      {"max_displacement", AutoParameter::read_only,
+       [this]() { return m_instance->max_displacement; }},
+      {"time_step_min", AutoParameter::read_only,
+       [this]() { return m_instance->time_step_min; }},
+      {"time_step_max", AutoParameter::read_only,
+       [this]() { return m_instance->time_step_max; }},
+      {"max_growth", AutoParameter::read_only,
+       [this]() { return m_instance->max_growth; }},
+  });
+}
+
+void AdaptiveTimeStep::do_construct(VariantMap const &params) {
+  auto const max_d = get_value<double>(params, "max_displacement");
+  auto const dt_min = get_value<double>(params, "time_step_min");
+  auto const dt_max = get_value<double>(params, "time_step_max");
+  auto const max_growth = get_value_or<double>(params, "max_growth", 1.05);
+
+  context()->parallel_try_catch([&]() {
+    m_instance = std::make_shared<::AdaptiveTimeStepParameters>(
+        max_d, dt_min, dt_max, max_growth);
+  });
+}
+
+} // namespace Integrators
+} // namespace ScriptInterface
@@ -21,6 +21,7 @@
 
 #include "script_interface/ScriptInterface.hpp"
 
+#include "BAOABLangevin.hpp"
 #include "BrownianDynamics.hpp"
 #include "SteepestDescent.hpp"
 #include "StokesianDynamics.hpp"
@@ -29,6 +30,7 @@
 
 #include "core/forcecap.hpp"
 #include "core/integrate.hpp"
+#include "core/integrators/adaptive_time_step.hpp"
 
 #include <memory>
 #include <string>
@@ -56,6 +58,9 @@ IntegratorHandle::IntegratorHandle() {
          case INTEG_METHOD_BD:
            return Variant{
                std::dynamic_pointer_cast<BrownianDynamics>(m_instance)};
+         case INTEG_METHOD_BAOAB:
+           return Variant{
+               std::dynamic_pointer_cast<BAOABLangevin>(m_instance)};
 #ifdef STOKESIAN_DYNAMICS
          case INTEG_METHOD_SD:
            return Variant{
@@ -79,6 +84,22 @@ IntegratorHandle::IntegratorHandle() {
       {"force_cap",
        [](Variant const &v) { set_force_cap(get_value<double>(v)); },
        []() { return get_force_cap(); }},
+      {"adaptive_time_step",
+       [this](Variant const &v) {
+         if (is_none(v)) {
+           m_adaptive_time_step = nullptr;
+           register_adaptive_time_step(nullptr);
+           return;
+         }
+         m_adaptive_time_step =
+             get_value<std::shared_ptr<AdaptiveTimeStep>>(v);
+         register_adaptive_time_step(m_adaptive_time_step->instance());
+       },
+       [this]() {
+         if (m_adaptive_time_step)
+           return make_variant(m_adaptive_time_step);
+         return make_variant(none);
+       }},
   });
 }
 
@@ -23,6 +23,7 @@
 #include "script_interface/ScriptInterface.hpp"
 #include "script_interface/auto_parameters/AutoParameters.hpp"
 
+#include "AdaptiveTimeStep.hpp"
 #include "Integrator.hpp"
 
 #include <memory>
@@ -33,6 +34,7 @@ namespace Integrators {
 
 class IntegratorHandle : public AutoParameters<IntegratorHandle> {
   std::shared_ptr<Integrator> m_instance;
+  std::shared_ptr<AdaptiveTimeStep> m_adaptive_time_step;
 
 public:
   IntegratorHandle();
@@ -19,6 +19,8 @@
 
 #include "initialize.hpp"
 
+#include "AdaptiveTimeStep.hpp"
+#include "BAOABLangevin.hpp"
 #include "BrownianDynamics.hpp"
 #include "IntegratorHandle.hpp"
 #include "SteepestDescent.hpp"
@@ -32,6 +34,8 @@ namespace Integrators {
 
 void initialize(Utils::Factory<ObjectHandle> *om) {
   om->register_new<IntegratorHandle>("Integrators::IntegratorHandle");
+  om->register_new<AdaptiveTimeStep>("Integrators::AdaptiveTimeStep");
+  om->register_new<BAOABLangevin>("Integrators::BAOABLangevin");
   om->register_new<BrownianDynamics>("Integrators::BrownianDynamics");
   om->register_new<SteepestDescent>("Integrators::SteepestDescent");
 #ifdef STOKESIAN_DYNAMICS
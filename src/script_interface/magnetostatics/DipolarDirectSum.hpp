@@ -42,6 +42,8 @@ public:
     add_parameters({
         {"n_replicas", AutoParameter::read_only,
          [this]() { return actor()->n_replicas; }},
+        {"n_table", AutoParameter::read_only,
+         [this]() { return actor()->n_table; }},
     });
   }
 
@@ -49,7 +51,8 @@ public:
     context()->parallel_try_catch([this, &params]() {
       m_actor = std::make_shared<CoreActorClass>(
           get_value<double>(params, "prefactor"),
-          get_value<int>(params, "n_replicas"));
+          get_value<int>(params, "n_replicas"),
+          get_value<int>(params, "n_table"));
     });
   }
 };
@@ -67,6 +67,9 @@ public:
     do_set_parameter("search_algorithm",
                      Variant{get_value_or<std::string>(
                          params, "search_algorithm", "order_n")});
+    do_set_parameter("number_of_trial_positions",
+                     Variant{get_value_or<int>(
+                         params, "number_of_trial_positions", 1)});
   }
 
 protected:
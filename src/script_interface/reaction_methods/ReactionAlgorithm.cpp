@@ -78,6 +78,13 @@ ReactionAlgorithm::ReactionAlgorithm() {
           }
           return std::string("parallel");
         }},
+       {"number_of_trial_positions",
+        [this](Variant const &v) {
+          context()->parallel_try_catch([&]() {
+            RE()->set_number_of_trial_positions(get_value<int>(v));
+          });
+        },
+        [this]() { return RE()->get_number_of_trial_positions(); }},
        {"particle_inside_exclusion_range_touched",
         [this](Variant const &v) {
           RE()->particle_inside_exclusion_range_touched = get_value<bool>(v);
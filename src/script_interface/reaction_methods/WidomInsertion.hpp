@@ -52,6 +52,14 @@ public:
                              "No search algorithm for WidomInsertion");
                        }
                      },
+                     []() { return none; }},
+                    {"number_of_trial_positions",
+                     [this](Variant const &) {
+                       if (context()->is_head_node()) {
+                         throw std::runtime_error(
+                             "No configurational bias for WidomInsertion");
+                       }
+                     },
                      []() { return none; }}});
   }
 
@@ -24,6 +24,7 @@
 #include "core/cells.hpp"
 #include "core/event.hpp"
 #include "core/grid.hpp"
+#include "core/memory_usage.hpp"
 #include "core/object-in-fluid/oif_global_forces.hpp"
 #include "core/particle_node.hpp"
 #include "core/rotate_system.hpp"
@@ -118,6 +119,14 @@ Variant System::do_call_method(std::string const &name,
     auto const pos2 = get_value<Utils::Vector3d>(parameters, "pos2");
     return ::box_geo.get_mi_vector(pos2, pos1);
   }
+  if (name == "memory_usage") {
+    VariantMap entries;
+    for (auto const &entry : MemoryUsage::memory_usage()) {
+      entries[entry.name] = VariantMap{
+          {"min", entry.min}, {"max", entry.max}, {"sum", entry.sum}};
+    }
+    return entries;
+  }
   if (name == "rotate_system") {
     rotate_system(get_value<double>(parameters, "phi"),
                   get_value<double>(parameters, "theta"),
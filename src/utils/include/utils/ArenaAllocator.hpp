@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ESPRESSO_UTILS_ARENA_ALLOCATOR_HPP
+#define ESPRESSO_UTILS_ARENA_ALLOCATOR_HPP
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace Utils {
+/**
+ * @brief Pool of small memory blocks.
+ *
+ * Blocks of up to @ref max_block_size bytes are carved out of large
+ * chunks and are recycled through one free list per power-of-two size
+ * class, which makes allocation and deallocation of small blocks a
+ * constant-time list operation. Blocks of neighboring allocations are
+ * contiguous in memory. The chunks are only released when the arena
+ * is destroyed. Larger requests are forwarded to the global operator
+ * new. The arena is not thread-safe.
+ */
+class Arena {
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+public:
+  static constexpr std::size_t min_block_size = 16u;
+  static constexpr std::size_t n_size_classes = 5u;
+  static constexpr std::size_t max_block_size = min_block_size
+                                                << (n_size_classes - 1u);
+  static constexpr std::size_t chunk_size = 64u * 1024u;
+
+  Arena() = default;
+  Arena(Arena const &) = delete;
+  Arena &operator=(Arena const &) = delete;
+
+  void *allocate(std::size_t bytes) {
+    if (bytes > max_block_size) {
+      return ::operator new(bytes);
+    }
+    auto &head = m_free_lists[size_class(bytes)];
+    if (head != nullptr) {
+      auto const block = head;
+      head = block->next;
+      return block;
+    }
+    return carve(block_size(size_class(bytes)));
+  }
+
+  void deallocate(void *ptr, std::size_t bytes) noexcept {
+    if (bytes > max_block_size) {
+      ::operator delete(ptr);
+      return;
+    }
+    auto &head = m_free_lists[size_class(bytes)];
+    head = ::new (ptr) FreeBlock{head};
+  }
+
+  /** @brief Memory reserved by the chunks, in bytes. */
+  std::size_t reserved() const { return m_chunks.size() * chunk_size; }
+
+  /** @brief Size of the blocks in a size class, in bytes. */
+  static constexpr std::size_t block_size(std::size_t size_class) {
+    return min_block_size << size_class;
+  }
+
+  /** @brief Smallest size class whose blocks hold @p bytes bytes. */
+  static constexpr std::size_t size_class(std::size_t bytes) {
+    std::size_t k = 0u;
+    while (block_size(k) < bytes) {
+      ++k;
+    }
+    return k;
+  }
+
+private:
+  void *carve(std::size_t size) {
+    if (m_chunk_offset + size > chunk_size) {
+      m_chunks.emplace_back(new std::byte[chunk_size]);
+      m_chunk_offset = 0u;
+    }
+    auto const block = m_chunks.back().get() + m_chunk_offset;
+    m_chunk_offset += size;
+    return block;
+  }
+
+  std::array<FreeBlock *, n_size_classes> m_free_lists = {};
+  std::vector<std::unique_ptr<std::byte[]>> m_chunks;
+  std::size_t m_chunk_offset = chunk_size;
+};
+
+/**
+ * @brief Arena of the process.
+ *
+ * The arena is intentionally never destroyed, such that containers
+ * with static storage duration can still release their memory during
+ * program termination.
+ */
+inline Arena &process_arena() {
+  static auto *const arena = new Arena();
+  return *arena;
+}
+
+/**
+ * @brief Stateless allocator drawing from the @ref process_arena.
+ *
+ * Suited for many small, short-lived containers, such as the bond and
+ * exclusion lists of particles, which are created and destroyed when
+ * particles migrate between cells, MPI ranks and ghost layers.
+ */
+template <class T> struct ArenaAllocator {
+  static_assert(alignof(T) <= Arena::min_block_size);
+
+  using value_type = T;
+
+  ArenaAllocator() noexcept = default;
+  template <class U> ArenaAllocator(ArenaAllocator<U> const &) noexcept {}
+
+  T *allocate(std::size_t n) {
+    return static_cast<T *>(process_arena().allocate(n * sizeof(T)));
+  }
+
+  void deallocate(T *ptr, std::size_t n) noexcept {
+    process_arena().deallocate(ptr, n * sizeof(T));
+  }
+
+  template <class U>
+  constexpr bool operator==(ArenaAllocator<U> const &) const {
+    return true;
+  }
+  template <class U>
+  constexpr bool operator!=(ArenaAllocator<U> const &) const {
+    return false;
+  }
+};
+
+} // namespace Utils
+
+#endif
@@ -103,6 +103,9 @@ public:
   /** @brief Maximal size of the cache. */
   size_type max_size() const { return m_max_size; }
 
+  /** @brief Number of buckets of the underlying hash table. */
+  size_type bucket_count() const { return m_cache.bucket_count(); }
+
   /** @brief Put a value into the cache.
    *
    * If the value already exists, it is overwritten.
@@ -20,6 +20,7 @@
 #ifndef UTILS_INCLUDE_UTILS_COMPACT_VECTOR_HPP
 #define UTILS_INCLUDE_UTILS_COMPACT_VECTOR_HPP
 
+#include "ArenaAllocator.hpp"
 #include "serialization/array.hpp"
 
 #include <boost/container/vector.hpp>
@@ -39,13 +40,15 @@ using container_options = boost::container::vector_options<
  * Custom vector container optimized for size.
  * Allocate only 16 bits for the number of elements, and take only
  * <tt>16 + N * sizeof(T)</tt> bits during serialization in a binary archive.
+ * The elements are stored in the @ref process_arena, since these vectors
+ * are typically small and frequently created and destroyed.
  */
 template <typename T>
 class compact_vector // NOLINT(bugprone-exception-escape)
-    : public boost::container::vector<T, boost::container::new_allocator<T>,
+    : public boost::container::vector<T, ArenaAllocator<T>,
                                       detail::container_options> {
 public:
-  using boost::container::vector<T, boost::container::new_allocator<T>,
+  using boost::container::vector<T, ArenaAllocator<T>,
                                  detail::container_options>::vector;
 
   template <class Archive> void save(Archive &oa, unsigned int const) const {
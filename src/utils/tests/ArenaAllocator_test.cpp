@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#define BOOST_TEST_MODULE Utils::ArenaAllocator
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <utils/ArenaAllocator.hpp>
+#include <utils/compact_vector.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+BOOST_AUTO_TEST_CASE(size_classes) {
+  using Utils::Arena;
+  static_assert(Arena::size_class(0u) == 0u);
+  static_assert(Arena::size_class(1u) == 0u);
+  static_assert(Arena::size_class(Arena::min_block_size) == 0u);
+  static_assert(Arena::size_class(Arena::min_block_size + 1u) == 1u);
+  static_assert(Arena::size_class(Arena::max_block_size) ==
+                Arena::n_size_classes - 1u);
+  static_assert(Arena::block_size(Arena::n_size_classes - 1u) ==
+                Arena::max_block_size);
+  BOOST_TEST_PASSPOINT();
+}
+
+BOOST_AUTO_TEST_CASE(recycling) {
+  Utils::Arena arena;
+  BOOST_CHECK_EQUAL(arena.reserved(), 0u);
+
+  /* small blocks are carved from one chunk */
+  auto const p1 = arena.allocate(8u);
+  auto const p2 = arena.allocate(8u);
+  BOOST_CHECK_EQUAL(arena.reserved(), Utils::Arena::chunk_size);
+  BOOST_CHECK_NE(p1, p2);
+  BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(p1) %
+                        Utils::Arena::min_block_size,
+                    0u);
+  auto const stride =
+      static_cast<std::byte *>(p2) - static_cast<std::byte *>(p1);
+  BOOST_CHECK_EQUAL(stride,
+                    static_cast<std::ptrdiff_t>(Utils::Arena::min_block_size));
+
+  /* freed blocks are reused by requests of the same size class */
+  arena.deallocate(p1, 8u);
+  auto const p3 = arena.allocate(12u);
+  BOOST_CHECK_EQUAL(p3, p1);
+  arena.deallocate(p2, 8u);
+  auto const p4 = arena.allocate(32u);
+  BOOST_CHECK_NE(p4, p2);
+  arena.deallocate(p3, 12u);
+  arena.deallocate(p4, 32u);
+
+  /* large blocks bypass the arena */
+  auto const p5 = arena.allocate(Utils::Arena::max_block_size + 1u);
+  arena.deallocate(p5, Utils::Arena::max_block_size + 1u);
+  BOOST_CHECK_EQUAL(arena.reserved(), Utils::Arena::chunk_size);
+
+  /* new chunks are reserved when the current chunk is exhausted */
+  std::vector<void *> blocks;
+  auto const n_blocks_per_chunk =
+      Utils::Arena::chunk_size / Utils::Arena::max_block_size;
+  for (std::size_t i = 0u; i < n_blocks_per_chunk + 1u; ++i) {
+    blocks.emplace_back(arena.allocate(Utils::Arena::max_block_size));
+  }
+  BOOST_CHECK_EQUAL(arena.reserved(), 2u * Utils::Arena::chunk_size);
+  for (auto const block : blocks) {
+    arena.deallocate(block, Utils::Arena::max_block_size);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(allocator) {
+  static_assert(Utils::ArenaAllocator<int>{} == Utils::ArenaAllocator<char>{});
+
+  /* containers keep their values while growing beyond the size classes */
+  std::vector<int, Utils::ArenaAllocator<int>> values;
+  for (int i = 0; i < 200; ++i) {
+    values.push_back(i);
+  }
+  std::vector<int> ref(200);
+  std::iota(ref.begin(), ref.end(), 0);
+  BOOST_CHECK_EQUAL_COLLECTIONS(values.begin(), values.end(), ref.begin(),
+                                ref.end());
+
+  /* compact vectors draw from the process arena */
+  auto const reserved = Utils::process_arena().reserved();
+  std::vector<Utils::compact_vector<int>> lists(100);
+  for (auto &list : lists) {
+    list.assign({1, 2, 3});
+  }
+  BOOST_CHECK_GE(Utils::process_arena().reserved(), reserved);
+  BOOST_CHECK_GT(Utils::process_arena().reserved(), 0u);
+  for (auto const &list : lists) {
+    BOOST_CHECK_EQUAL(list.size(), 3u);
+    BOOST_CHECK_EQUAL(list[2], 3);
+  }
+}
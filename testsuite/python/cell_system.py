@@ -16,7 +16,9 @@
 # You should have received a copy of the GNU General Public License
 # along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #
+import itertools
 import unittest as ut
+import unittest_decorators as utx
 import espressomd
 import numpy as np
 import tests_common
@@ -80,6 +82,63 @@ class CellSystem(ut.TestCase):
             n_square_types={1}, cutoff_regular=0)
         self.check_node_grid()
 
+    @utx.skipIfMissingFeatures(["LENNARD_JONES"])
+    def test_diagnostics(self):
+        system = self.system
+        system.cell_system.set_regular_decomposition(use_verlet_lists=True)
+        system.cell_system.skin = 0.4
+        system.time_step = 0.01
+        cutoff = 1.
+        system.non_bonded_inter[0, 0].lennard_jones.set_params(
+            epsilon=1., sigma=0.5, cutoff=cutoff, shift="auto")
+        rebuild_reasons_ref = system.cell_system.get_diagnostics()[
+            "rebuild_reasons"]
+        np.random.seed(42)
+        pos = np.array(list(itertools.product(range(5), range(5), range(4))))
+        n_part = len(pos)
+        partcls = system.part.add(
+            pos=pos + np.random.uniform(-0.1, 0.1, size=(n_part, 3)),
+            v=np.random.normal(size=(n_part, 3)))
+
+        # the pair lists are built by the force calculation
+        diagnostics = system.cell_system.get_diagnostics()
+        self.assertIsNone(diagnostics["n_pairs"])
+        self.assertIsNone(diagnostics["n_pairs_beyond_cutoff"])
+        system.integrator.run(0)
+        diagnostics = system.cell_system.get_diagnostics()
+        self.assertEqual(diagnostics["n_particles"], n_part)
+        self.assertGreater(diagnostics["n_ghosts"], 0)
+        occupancy = diagnostics["cell_occupancy"]
+        self.assertEqual(sum(occupancy), diagnostics["n_cells"])
+        self.assertEqual(np.dot(np.arange(len(occupancy)), occupancy), n_part)
+        n_pairs_in_range = len(system.cell_system.get_pairs(cutoff))
+        n_pairs_in_skin = len(system.cell_system.get_pairs(cutoff + 0.4))
+        self.assertEqual(diagnostics["n_pairs"], n_pairs_in_skin)
+        self.assertEqual(diagnostics["n_pairs_beyond_cutoff"],
+                         n_pairs_in_skin - n_pairs_in_range)
+        self.assertEqual(diagnostics["n_inner_pairs"], 0)
+        self.assertEqual(diagnostics["n_cluster_pairs"], 0)
+        self.assertGreater(
+            diagnostics["rebuild_reasons"]["particle_change"],
+            rebuild_reasons_ref["particle_change"])
+
+        # particle displacements and box changes trigger a rebuild
+        n_rebuilds = diagnostics["n_rebuilds"]
+        system.integrator.run(20)
+        diagnostics = system.cell_system.get_diagnostics()
+        self.assertGreater(diagnostics["n_rebuilds"], n_rebuilds)
+        self.assertGreater(diagnostics["rebuild_reasons"]["displacement"],
+                           rebuild_reasons_ref["displacement"])
+        system.box_l = [5.1, 5.1, 5.1]
+        system.integrator.run(0)
+        diagnostics = system.cell_system.get_diagnostics()
+        self.assertGreater(diagnostics["rebuild_reasons"]["box_change"],
+                           rebuild_reasons_ref["box_change"])
+
+        partcls.remove()
+        system.box_l = [5., 5., 5.]
+        system.non_bonded_inter[0, 0].lennard_jones.deactivate()
+
 
 if __name__ == "__main__":
     ut.main()
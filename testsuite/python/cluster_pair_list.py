@@ -0,0 +1,99 @@
+#
+# Copyright (C) 2022 The ESPResSo project
+#
+# This file is part of ESPResSo.
+#
+# ESPResSo is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ESPResSo is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+import unittest as ut
+import unittest_decorators as utx
+import espressomd
+import espressomd.electrostatics
+import numpy as np
+
+
+@utx.skipIfMissingFeatures(["LENNARD_JONES", "WCA", "ELECTROSTATICS"])
+class ClusterPairList(ut.TestCase):
+    """
+    Check that the cluster pair lists yield the same forces, energies
+    and pressures as the particle pair lists during an integration.
+    """
+    system = espressomd.System(box_l=[8., 9., 10.])
+    system.time_step = 0.005
+    system.cell_system.skin = 0.3
+
+    def setUp(self):
+        self.system.non_bonded_inter[0, 0].lennard_jones.set_params(
+            epsilon=1., sigma=1., cutoff=2.5, shift="auto")
+        self.system.non_bonded_inter[0, 1].wca.set_params(
+            epsilon=1., sigma=1.)
+        np.random.seed(42)
+        n_part = 200
+        self.system.part.add(
+            pos=np.random.random((n_part, 3)) * self.system.box_l,
+            v=np.random.normal(size=(n_part, 3)),
+            type=np.random.randint(0, 2, n_part),
+            q=np.repeat([-1., 1.], n_part // 2))
+        self.system.integrator.set_steepest_descent(
+            f_max=0., gamma=0.1, max_displacement=0.05)
+        self.system.integrator.run(50)
+        self.system.integrator.set_vv()
+        dh = espressomd.electrostatics.DH(prefactor=1., kappa=1., r_cut=2.)
+        self.system.actors.add(dh)
+
+    def tearDown(self):
+        self.system.actors.clear()
+        self.system.part.clear()
+        self.system.cell_system.verlet_cluster_size = 1
+
+    def get_observables(self):
+        energy = self.system.analysis.energy()["total"]
+        pressure = self.system.analysis.pressure()["total"]
+        return np.copy(self.system.part.all().f), energy, pressure
+
+    def check_cluster_size(self, cluster_size):
+        # snapshot of the initial state
+        p = self.system.part.all()
+        pos = np.copy(p.pos)
+        vel = np.copy(p.v)
+        trajectory_ref = []
+        self.system.cell_system.verlet_cluster_size = 1
+        for _ in range(4):
+            self.system.integrator.run(10)
+            trajectory_ref.append(self.get_observables())
+        p.pos = pos
+        p.v = vel
+        self.system.cell_system.verlet_cluster_size = cluster_size
+        for forces_ref, energy_ref, pressure_ref in trajectory_ref:
+            self.system.integrator.run(10)
+            forces, energy, pressure = self.get_observables()
+            np.testing.assert_allclose(forces, forces_ref, atol=1e-8)
+            self.assertAlmostEqual(energy, energy_ref, delta=1e-7)
+            self.assertAlmostEqual(pressure, pressure_ref, delta=1e-7)
+
+    def test_cluster_size_4(self):
+        self.check_cluster_size(4)
+
+    def test_cluster_size_8(self):
+        self.check_cluster_size(8)
+
+    def test_exceptions(self):
+        with self.assertRaisesRegex(ValueError, "Verlet cluster size must be 1, 4 or 8"):
+            self.system.cell_system.verlet_cluster_size = 2
+        self.assertEqual(self.system.cell_system.verlet_cluster_size, 1)
+
+
+if __name__ == "__main__":
+    ut.main()
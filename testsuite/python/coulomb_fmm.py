@@ -0,0 +1,130 @@
+#
+# Copyright (C) 2022 The ESPResSo project
+#
+# This file is part of ESPResSo.
+#
+# ESPResSo is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ESPResSo is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+
+import espressomd
+import espressomd.electrostatics
+import numpy as np
+import unittest as ut
+import unittest_decorators as utx
+
+
+@utx.skipIfMissingFeatures(["ELECTROSTATICS"])
+class FastMultipoleMethod(ut.TestCase):
+
+    """
+    Compare the fast multipole method with a direct summation of all
+    pairs of charges in an open system.
+
+    """
+
+    system = espressomd.System(box_l=[20., 20., 20.])
+    system.time_step = 0.01
+    system.cell_system.skin = 0.4
+    system.periodicity = [False, False, False]
+
+    def setUp(self):
+        np.random.seed(seed=42)
+        num_part = 600
+        # charged droplet with a net charge
+        positions = np.random.random((num_part, 3)) * 10. + 5.
+        charges = np.random.choice([-1., 1.], size=num_part)
+        charges[:10] = 1.
+        self.system.part.add(pos=positions, q=charges)
+
+    def tearDown(self):
+        self.system.actors.clear()
+        self.system.part.clear()
+
+    def reference(self):
+        prefactor = 2.
+        partcls = self.system.part.all()
+        pos = partcls.pos
+        q = partcls.q
+        d = pos[:, np.newaxis, :] - pos[np.newaxis, :, :]
+        dist = np.linalg.norm(d, axis=2)
+        np.fill_diagonal(dist, np.inf)
+        forces = prefactor * q[:, np.newaxis] * np.sum(
+            q[np.newaxis, :, np.newaxis] * d / dist[:, :, np.newaxis]**3,
+            axis=1)
+        energy = prefactor * 0.5 * np.sum(np.outer(q, q) / dist)
+        return energy, forces
+
+    def calc(self, solver):
+        self.system.actors.add(solver)
+        self.system.integrator.run(0)
+        energy = self.system.analysis.energy()['coulomb']
+        forces = np.copy(self.system.part.all().f)
+        self.system.actors.clear()
+        return energy, forces
+
+    def test_convergence(self):
+        ref_energy, ref_forces = self.reference()
+        ref_norm = np.linalg.norm(ref_forces)
+        errors = []
+        for order in [2, 4, 6]:
+            energy, forces = self.calc(espressomd.electrostatics.FMM(
+                prefactor=2., accuracy=1e-3, order=order, leaf_size=16))
+            errors.append(np.linalg.norm(forces - ref_forces) / ref_norm)
+            np.testing.assert_allclose(energy, ref_energy, rtol=1e-2)
+        self.assertLess(errors[0], 5e-3)
+        self.assertLess(errors[1], 0.1 * errors[0])
+        self.assertLess(errors[2], 0.1 * errors[1])
+
+        # a small opening angle gives accurate results at low order
+        _, forces = self.calc(espressomd.electrostatics.FMM(
+            prefactor=2., accuracy=1e-3, order=2, theta=0.2, leaf_size=16))
+        self.assertLess(np.linalg.norm(forces - ref_forces) / ref_norm,
+                        0.5 * errors[0])
+
+    def test_tuning(self):
+        ref_energy, ref_forces = self.reference()
+        for accuracy in [1e-3, 1e-5]:
+            solver = espressomd.electrostatics.FMM(
+                prefactor=2., accuracy=accuracy)
+            self.assertFalse(solver.is_tuned)
+            self.assertEqual(solver.order, -1)
+            energy, forces = self.calc(solver)
+            self.assertTrue(solver.is_tuned)
+            self.assertGreaterEqual(solver.order, 1)
+            error = np.linalg.norm(forces - ref_forces) / \
+                np.linalg.norm(ref_forces)
+            self.assertLess(error, 2. * accuracy)
+            np.testing.assert_allclose(energy, ref_energy, rtol=10. * accuracy)
+
+    def test_dynamics(self):
+        # energy conservation during the Coulomb explosion of a droplet
+        system = self.system
+        system.part.clear()
+        grid = np.mgrid[0:6, 0:6, 0:6].reshape((3, -1)).T
+        positions = 7. + 1.2 * grid + 0.1 * np.random.random(grid.shape)
+        system.part.add(pos=positions, q=np.ones(len(grid)))
+        system.actors.add(espressomd.electrostatics.FMM(
+            prefactor=0.2, accuracy=1e-5, order=6))
+        system.integrator.run(0)
+        energy_start = system.analysis.energy()['total']
+        system.integrator.run(200)
+        energy_end = system.analysis.energy()['total']
+        self.assertGreater(system.analysis.energy()['kinetic'],
+                           0.1 * energy_start)
+        np.testing.assert_allclose(energy_end, energy_start, rtol=1e-4)
+
+
+if __name__ == "__main__":
+    ut.main()
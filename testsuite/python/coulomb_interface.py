@@ -110,6 +110,59 @@ class Test(ut.TestCase):
             with self.assertRaisesRegex(ValueError, f"Parameter '{key}' must be > 0"):
                 espressomd.electrostatics.MMM1D(**invalid_params)
 
+    def test_fmm(self):
+        self.system.periodicity = [False, False, False]
+        valid_params = dict(
+            prefactor=1., accuracy=1e-3, order=4, theta=0.3, leaf_size=8,
+            check_neutrality=True, charge_neutrality_tolerance=7e-12)
+        tests_common.generate_test_for_actor_class(
+            self.system, espressomd.electrostatics.FMM, valid_params)(self)
+
+        for key in ["prefactor", "accuracy", "leaf_size"]:
+            invalid_params = valid_params.copy()
+            invalid_params[key] = -2
+            with self.assertRaisesRegex(ValueError, f"Parameter '{key}' must be > 0"):
+                espressomd.electrostatics.FMM(**invalid_params)
+        for order in [0, 13]:
+            invalid_params = valid_params.copy()
+            invalid_params["order"] = order
+            with self.assertRaisesRegex(ValueError, "Parameter 'order' must be >= 1 and <= 12"):
+                espressomd.electrostatics.FMM(**invalid_params)
+        for theta in [0., 1.]:
+            invalid_params = valid_params.copy()
+            invalid_params["theta"] = theta
+            with self.assertRaisesRegex(ValueError, "Parameter 'theta' must be > 0 and < 1"):
+                espressomd.electrostatics.FMM(**invalid_params)
+
+        self.system.periodicity = [False, False, True]
+        actor = espressomd.electrostatics.FMM(**valid_params)
+        with self.assertRaisesRegex(Exception, r"CoulombFMM: requires periodicity \(False, False, False\)"):
+            self.system.actors.add(actor)
+        self.assertEqual(len(self.system.actors), 0)
+
+    def test_rbe(self):
+        valid_params = dict(
+            prefactor=1., alpha=1.2, r_cut=2.5, batch_size=20, seed=42,
+            check_neutrality=True, charge_neutrality_tolerance=7e-12)
+        tests_common.generate_test_for_actor_class(
+            self.system, espressomd.electrostatics.RBE, valid_params)(self)
+
+        for key in ["prefactor", "alpha", "r_cut", "batch_size"]:
+            invalid_params = valid_params.copy()
+            invalid_params[key] = -2
+            with self.assertRaisesRegex(ValueError, f"Parameter '{key}' must be > 0"):
+                espressomd.electrostatics.RBE(**invalid_params)
+        invalid_params = valid_params.copy()
+        invalid_params["seed"] = -2
+        with self.assertRaisesRegex(ValueError, "Parameter 'seed' must be >= 0"):
+            espressomd.electrostatics.RBE(**invalid_params)
+
+        self.system.periodicity = [True, True, False]
+        actor = espressomd.electrostatics.RBE(**valid_params)
+        with self.assertRaisesRegex(Exception, r"CoulombRBE: requires periodicity \(True, True, True\)"):
+            self.system.actors.add(actor)
+        self.assertEqual(len(self.system.actors), 0)
+
     @utx.skipIfMissingGPU()
     @utx.skipIfMissingFeatures(["CUDA", "MMM1D_GPU"])
     def test_mmm1d_gpu(self):
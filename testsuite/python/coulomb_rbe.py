@@ -0,0 +1,146 @@
+#
+# Copyright (C) 2022 The ESPResSo project
+#
+# This file is part of ESPResSo.
+#
+# ESPResSo is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ESPResSo is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+
+import espressomd
+import espressomd.electrostatics
+import numpy as np
+import unittest as ut
+import unittest_decorators as utx
+
+P3M_PARAMS = {'cao': 7, 'r_cut': 4.477272033691406,
+              'alpha': 0.845808585620971, 'mesh': 32}
+
+
+@utx.skipIfMissingFeatures(["LENNARD_JONES", "P3M"])
+class RandomBatchEwald(ut.TestCase):
+
+    """
+    Compare the Random Batch Ewald solver with P3M. The k-space energy is
+    exact, while the k-space forces are unbiased estimates whose variance
+    decreases with the batch size.
+
+    """
+
+    system = espressomd.System(box_l=[10., 10., 10.])
+    system.time_step = 0.01
+    system.cell_system.skin = 0.4
+
+    def setUp(self):
+        np.random.seed(seed=42)
+        num_pairs = 100
+        positions = np.random.random((2 * num_pairs, 3))
+        self.system.part.add(pos=positions * self.system.box_l,
+                             q=num_pairs * [-1, 1])
+        self.system.non_bonded_inter[0, 0].lennard_jones.set_params(
+            epsilon=1.0, sigma=1.0, cutoff=2**(1.0 / 6.0), shift="auto")
+        self.system.integrator.set_steepest_descent(
+            f_max=1, gamma=0.01, max_displacement=0.01)
+        self.system.integrator.run(100)
+        self.system.integrator.set_vv()
+
+    def tearDown(self):
+        self.system.actors.clear()
+        self.system.part.clear()
+        self.system.thermostat.turn_off()
+
+    def rbe(self, **kwargs):
+        return espressomd.electrostatics.RBE(
+            prefactor=2., alpha=P3M_PARAMS['alpha'],
+            r_cut=P3M_PARAMS['r_cut'], **kwargs)
+
+    def calc_forces(self):
+        # invalidate the forces, since every force calculation draws a
+        # new batch of wave vectors
+        self.system.part.all().q = self.system.part.all().q
+        self.system.integrator.run(0)
+        return np.copy(self.system.part.all().f)
+
+    def reference(self):
+        p3m = espressomd.electrostatics.P3M(
+            prefactor=2., accuracy=1e-6, tune=False, **P3M_PARAMS)
+        self.system.actors.add(p3m)
+        energy = self.system.analysis.energy()
+        forces = self.calc_forces()
+        self.system.actors.clear()
+        return energy, forces
+
+    def test_energy(self):
+        ref_energy, _ = self.reference()
+        self.system.actors.add(self.rbe(batch_size=10, seed=42))
+        energy = self.system.analysis.energy()
+        np.testing.assert_allclose(energy['coulomb'], ref_energy['coulomb'],
+                                   rtol=1e-6)
+
+    def test_forces(self):
+        _, ref_forces = self.reference()
+
+        def rms_error(forces):
+            return np.sqrt(np.mean(np.square(forces - ref_forces)))
+
+        # the variance decreases with the batch size
+        errors = []
+        for batch_size in [10, 100, 1000]:
+            self.system.actors.add(self.rbe(batch_size=batch_size, seed=42))
+            errors.append(np.mean([rms_error(self.calc_forces())
+                                   for _ in range(5)]))
+            self.system.actors.clear()
+        self.assertGreater(errors[0], 2. * errors[1])
+        self.assertGreater(errors[1], 2. * errors[2])
+
+        # the estimate is unbiased
+        self.system.actors.add(self.rbe(batch_size=100, seed=42))
+        forces = [self.calc_forces() for _ in range(100)]
+        self.assertLess(rms_error(np.mean(forces, axis=0)), 0.2 * errors[1])
+
+        # the same seed yields the same sequence of wave vectors
+        self.system.actors.clear()
+        self.system.actors.add(self.rbe(batch_size=100, seed=42))
+        np.testing.assert_allclose(self.calc_forces(), forces[0], atol=1e-10)
+        self.system.actors.clear()
+        self.system.actors.add(self.rbe(batch_size=100, seed=43))
+        self.assertGreater(np.max(np.abs(self.calc_forces() - forces[0])), 0.1)
+
+    def test_dynamics(self):
+        # the stochastic forces preserve the Coulomb energy of a
+        # thermalized electrolyte
+        system = self.system
+        energies = []
+        pos = np.copy(system.part.all().pos)
+        p3m_params = dict(P3M_PARAMS, mesh=16, cao=5)
+        for solver in [espressomd.electrostatics.P3M(
+                prefactor=2., accuracy=1e-3, tune=False, **p3m_params),
+                self.rbe(batch_size=100, seed=42)]:
+            system.part.all().pos = pos
+            system.part.all().v = [0., 0., 0.]
+            system.thermostat.set_langevin(kT=1., gamma=1., seed=42)
+            system.actors.add(solver)
+            system.integrator.run(100)
+            samples = []
+            for _ in range(20):
+                system.integrator.run(10)
+                samples.append(system.analysis.energy()['coulomb'])
+            energies.append(np.mean(samples))
+            system.actors.clear()
+            system.thermostat.turn_off()
+        np.testing.assert_allclose(energies[1], energies[0], rtol=0.05)
+
+
+if __name__ == "__main__":
+    ut.main()
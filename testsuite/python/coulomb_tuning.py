@@ -16,6 +16,8 @@
 # You should have received a copy of the GNU General Public License
 # along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #
+import os
+import tempfile
 import numpy as np
 import unittest as ut
 import unittest_decorators as utx
@@ -53,6 +55,23 @@ class CoulombCloudWallTune(ut.TestCase):
             prefactor=1., accuracy=5e-4, tune=True)
         self.compare(actor)
 
+    def test_p3m_cpu_fftw_wisdom(self):
+        with tempfile.TemporaryDirectory() as tmp_directory:
+            wisdom_file = os.path.join(tmp_directory, "fftw.wisdom")
+            actor = espressomd.electrostatics.P3M(
+                prefactor=1., accuracy=5e-4, tune=True,
+                fftw_wisdom_file=wisdom_file)
+            self.assertEqual(actor.fftw_wisdom_file, wisdom_file)
+            self.compare(actor)
+            self.assertTrue(os.path.isfile(wisdom_file))
+            self.assertGreater(os.path.getsize(wisdom_file), 0)
+            # re-use the wisdom of the previous run
+            self.system.actors.clear()
+            actor = espressomd.electrostatics.P3M(
+                prefactor=1., accuracy=5e-4, tune=True,
+                fftw_wisdom_file=wisdom_file)
+            self.compare(actor)
+
     @utx.skipIfMissingGPU()
     def test_p3m_gpu(self):
         actor = espressomd.electrostatics.P3MGPU(
@@ -257,6 +257,47 @@ class Test(ut.TestCase):
         solver = espressomd.magnetostatics.DipolarDirectSumGpu(prefactor=1.)
         self.check_min_image_convention(solver, rtol=1e-5)
 
+    def test_tabulated_replicas_cpu(self):
+        system = self.system
+        system.periodicity = [True, True, True]
+        rng = np.random.default_rng(seed=42)
+        n_part = 8
+        # keep all pairs within half a box length, such that the explicit
+        # replica sum is centered on the minimum image
+        partcls = system.part.add(
+            pos=rng.random((n_part, 3)) * 0.45 * system.box_l,
+            dip=rng.random((n_part, 3)) - 0.5,
+            rotation=n_part * [(True, True, True)])
+
+        def calc(**kwargs):
+            system.actors.clear()
+            system.actors.add(espressomd.magnetostatics.DipolarDirectSumCpu(
+                prefactor=1., **kwargs))
+            system.integrator.run(steps=0, recalc_forces=True)
+            return (system.analysis.energy()["dipolar"], np.copy(partcls.f),
+                    np.copy(partcls.torque_lab))
+
+        ref_min_img = calc(n_replicas=0)
+        ref_replicas = calc(n_replicas=1)
+        errors = {}
+        for n_table in (8, 32):
+            values = calc(n_replicas=1, n_table=n_table)
+            errors[n_table] = [np.max(np.abs(x - y))
+                               for x, y in zip(values, ref_replicas)]
+        for i in range(3):
+            # error relative to the contribution of the replicas
+            scale = np.max(np.abs(ref_replicas[i] - ref_min_img[i]))
+            self.assertLess(errors[32][i], 1e-2 * scale)
+            self.assertLess(errors[32][i], errors[8][i] / 4.)
+
+        # tabulation requires full periodicity
+        system.actors.clear()
+        system.periodicity = [True, True, False]
+        with self.assertRaisesRegex(Exception, r"DipolarDirectSum: tabulation requires periodicity \(True, True, True\)"):
+            system.actors.add(espressomd.magnetostatics.DipolarDirectSumCpu(
+                prefactor=1., n_replicas=1, n_table=8))
+        self.assertEqual(len(system.actors), 0)
+
     @ut.skipIf(system.cell_system.get_state()["n_nodes"] == 1,
                "only runs for 2 or more MPI ranks")
     def test_inner_loop_consistency_cpu(self):
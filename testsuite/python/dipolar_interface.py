@@ -48,6 +48,11 @@ class Test(ut.TestCase):
             system, espressomd.magnetostatics.DipolarDirectSumCpu,
             dict(prefactor=3.4, n_replicas=3))
 
+    if espressomd.has_features("DIPOLES"):
+        test_dds_tabulated_cpu = tests_common.generate_test_for_actor_class(
+            system, espressomd.magnetostatics.DipolarDirectSumCpu,
+            dict(prefactor=3.4, n_replicas=1, n_table=4))
+
     if espressomd.has_features(
             "DIPOLAR_DIRECT_SUM") and espressomd.gpu_available():
         test_dds_gpu = tests_common.generate_test_for_actor_class(
@@ -104,6 +109,10 @@ class Test(ut.TestCase):
             DDSR(prefactor=1., n_replicas=-2)
         with self.assertRaisesRegex(ValueError, "Parameter 'prefactor' must be > 0"):
             DDSR(prefactor=-2., n_replicas=1)
+        with self.assertRaisesRegex(ValueError, "Parameter 'n_table' must be >= 0"):
+            DDSR(prefactor=1., n_replicas=1, n_table=-1)
+        with self.assertRaisesRegex(ValueError, "Parameter 'n_table' requires 'n_replicas' > 0"):
+            DDSR(prefactor=1., n_table=4)
         # run sanity checks
         self.system.periodicity = [True, True, False]
         ddsr = DDSR(prefactor=1., n_replicas=1)
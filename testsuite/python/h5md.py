@@ -27,6 +27,7 @@ import unittest_decorators as utx
 import numpy as np
 import espressomd
 import espressomd.interactions
+import espressomd.io.reader
 import espressomd.io.writer
 import espressomd.lees_edwards
 import espressomd.version
@@ -284,6 +285,56 @@ class H5mdTests(ut.TestCase):
             self.assertEqual(bond[0], i + 0)
             self.assertEqual(bond[1], i + 1)
 
+    def test_reader(self):
+        system = self.system
+        partcls = system.part.all()
+        pos_ref = np.copy(partcls.pos)
+        vel_ref = np.copy(partcls.v)
+        le_offset_ref = system.lees_edwards.pos_offset
+        reader = espressomd.io.reader.h5md.H5md(file_path=str(self.temp_file))
+        self.assertEqual(reader.n_frames, 2)
+        self.assertEqual(reader.file_path, str(self.temp_file))
+        with self.assertRaisesRegex(IndexError, "Frame 2 doesn't exist, the file contains 2 frames"):
+            reader.read_frame(2)
+        with self.assertRaisesRegex(Exception, "The bonded interaction has not yet been added"):
+            reader.read_frame(bond=espressomd.interactions.HarmonicBond(
+                k=1., r_0=1.))
+        # alter the system state, it must be restored from the last frame
+        system.part.clear()
+        system.part.add(pos=[0., 0., 0.], type=5)
+        system.box_l = [20., 20., 20.]
+        system.time = 0.
+        system.setup_type_map(type_list=[23])
+        frame = reader.read_frame(-1, bond=self.vb)
+        self.assertAlmostEqual(frame["time"], 12.3, delta=1e-12)
+        self.assertEqual(frame["step"], self.py_id_step)
+        self.assertAlmostEqual(system.time, 12.3, delta=1e-12)
+        np.testing.assert_allclose(np.copy(system.box_l), self.box_l)
+        self.assertAlmostEqual(system.lees_edwards.pos_offset, le_offset_ref,
+                               delta=1e-12)
+        self.assertEqual(system.lees_edwards.shear_direction, "x")
+        self.assertEqual(system.lees_edwards.shear_plane_normal, "y")
+        self.assertEqual(len(system.part), N_PART)
+        partcls = system.part.all()
+        np.testing.assert_array_equal(partcls.id, np.arange(N_PART))
+        np.testing.assert_allclose(np.copy(partcls.pos), pos_ref)
+        np.testing.assert_allclose(np.copy(partcls.v), vel_ref)
+        np.testing.assert_array_equal(partcls.type, 23)
+        if espressomd.has_features(['MASS']):
+            np.testing.assert_allclose(partcls.mass, 2.3)
+        if espressomd.has_features(['ELECTROSTATICS']):
+            np.testing.assert_allclose(partcls.q, np.arange(N_PART))
+        for i in range(N_PART - 1):
+            self.assertEqual(system.part.by_id(i).bonds, ((self.vb, i + 1),))
+        self.assertEqual(system.part.by_id(N_PART - 1).bonds, ())
+        self.assertEqual(system.number_of_particles(type=23), N_PART)
+        # the bonds aren't restored without a bonded interaction
+        reader.read_frame(0)
+        self.assertEqual(len(system.part), N_PART)
+        self.assertEqual(system.part.by_id(0).bonds, ())
+        for i in range(N_PART - 1):
+            system.part.by_id(i).add_bond((self.vb, i + 1))
+
     def test_script(self):
         assert sys.argv[0] == __file__
         # case #1: running a pypresso script
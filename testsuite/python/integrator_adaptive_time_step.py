@@ -0,0 +1,154 @@
+#
+# Copyright (C) 2020-2022 The ESPResSo project
+#
+# This file is part of ESPResSo.
+#
+# ESPResSo is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ESPResSo is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+import espressomd
+import unittest as ut
+import unittest_decorators as utx
+import numpy as np
+
+import espressomd
+import espressomd.integrate
+
+
+class AdaptiveTimeStep(ut.TestCase):
+
+    """Tests the adaptive time step control of the MD integrators"""
+    system = espressomd.System(box_l=[10., 10., 10.])
+    system.cell_system.skin = 0.4
+
+    def setUp(self):
+        self.system.time = 0.
+        self.system.time_step = 0.01
+        self.system.integrator.set_vv()
+
+    def tearDown(self):
+        self.system.integrator.adaptive_time_step = None
+        self.system.thermostat.turn_off()
+        self.system.part.clear()
+
+    def make_control(self, **kwargs):
+        params = {"max_displacement": 0.01, "time_step_min": 1e-4,
+                  "time_step_max": 0.1, "max_growth": 1.1}
+        params.update(kwargs)
+        return espressomd.integrate.AdaptiveTimeStep(**params)
+
+    def test_interface(self):
+        system = self.system
+        self.assertIsNone(system.integrator.adaptive_time_step)
+        control = self.make_control()
+        system.integrator.adaptive_time_step = control
+        control = system.integrator.adaptive_time_step
+        self.assertIsInstance(control, espressomd.integrate.AdaptiveTimeStep)
+        self.assertAlmostEqual(control.max_displacement, 0.01, delta=1e-12)
+        self.assertAlmostEqual(control.time_step_min, 1e-4, delta=1e-12)
+        self.assertAlmostEqual(control.time_step_max, 0.1, delta=1e-12)
+        self.assertAlmostEqual(control.max_growth, 1.1, delta=1e-12)
+        system.integrator.adaptive_time_step = None
+        self.assertIsNone(system.integrator.adaptive_time_step)
+        with self.assertRaisesRegex(ValueError, "Parameter 'max_displacement' must be > 0"):
+            self.make_control(max_displacement=0.)
+        with self.assertRaisesRegex(ValueError, "Parameter 'time_step_min' must be > 0"):
+            self.make_control(time_step_min=0.)
+        with self.assertRaisesRegex(ValueError, "Parameter 'time_step_max' must be >= 'time_step_min'"):
+            self.make_control(time_step_max=1e-5)
+        with self.assertRaisesRegex(ValueError, "Parameter 'max_growth' must be >= 1"):
+            self.make_control(max_growth=0.9)
+
+    @utx.skipIfMissingFeatures("EXTERNAL_FORCES")
+    def test_displacement_criterion(self):
+        system = self.system
+        system.integrator.adaptive_time_step = self.make_control()
+        # a fast particle reduces the time step immediately
+        p = system.part.add(pos=[1., 1., 1.], v=[0., 2., 0.])
+        system.integrator.run(1)
+        self.assertAlmostEqual(system.time_step, 0.005, delta=1e-12)
+        self.assertAlmostEqual(system.time, 0.005, delta=1e-12)
+        np.testing.assert_allclose(np.copy(p.pos), [1., 1.01, 1.], atol=1e-12)
+        # a slow particle lets the time step grow smoothly
+        p.v = [0., 0.02, 0.]
+        time_steps = []
+        for _ in range(40):
+            system.integrator.run(1)
+            time_steps.append(system.time_step)
+        np.testing.assert_allclose(time_steps[:10],
+                                   0.005 * 1.1**np.arange(1, 11), rtol=1e-12)
+        self.assertAlmostEqual(time_steps[-1], 0.1, delta=1e-12)
+        self.assertAlmostEqual(system.time, 0.005 + sum(time_steps),
+                               delta=1e-10)
+        # a particle at rest under a large force
+        p.v = [0., 0., 0.]
+        p.ext_force = [8e4, 0., 0.]
+        system.integrator.run(1)
+        self.assertAlmostEqual(system.time_step, np.sqrt(2. * 0.01 / 8e4),
+                               delta=1e-12)
+        # the time step is bounded
+        p.ext_force = [8e8, 0., 0.]
+        system.integrator.run(1)
+        self.assertAlmostEqual(system.time_step, 1e-4, delta=1e-12)
+        # fixed coordinates don't contribute
+        p.ext_force = [0., 0., 0.]
+        p.fix = [False, True, True]
+        p.v = [0., 5., 5.]
+        system.integrator.adaptive_time_step = self.make_control(
+            max_growth=1e4)
+        system.integrator.run(1)
+        self.assertAlmostEqual(system.time_step, 0.1, delta=1e-12)
+
+    @utx.skipIfMissingFeatures("WCA")
+    def test_overlap(self):
+        """An initial overlap reduces the time step, which keeps the energy
+        drift small while the particles are pushed apart."""
+        system = self.system
+        system.integrator.adaptive_time_step = self.make_control(
+            max_displacement=0.01, time_step_max=0.01)
+        partcls = system.part.add(pos=[[4.6, 5., 5.], [5.4, 5., 5.]])
+        system.non_bonded_inter[0, 0].wca.set_params(epsilon=1., sigma=1.)
+        energy = system.analysis.energy()["total"]
+        time_steps = []
+        for _ in range(100):
+            system.integrator.run(1)
+            time_steps.append(system.time_step)
+        system.non_bonded_inter[0, 0].wca.set_params(epsilon=0., sigma=0.)
+        self.assertLess(time_steps[0], 0.006)
+        self.assertAlmostEqual(system.analysis.energy()["total"] / energy, 1.,
+                               delta=0.05)
+        # the free particles limit the time step by their velocity
+        speed = np.linalg.norm(partcls.v, axis=1)
+        self.assertAlmostEqual(time_steps[-1], 0.01 / speed[0], delta=1e-10)
+
+    def test_thermostat(self):
+        """The Langevin prefactors follow the time step."""
+        system = self.system
+        kT = 1.5
+        system.time_step = 0.01
+        system.integrator.adaptive_time_step = self.make_control(
+            max_displacement=0.1, time_step_max=0.05, time_step_min=0.002)
+        system.thermostat.set_langevin(kT=kT, gamma=1., seed=42)
+        np.random.seed(42)
+        partcls = system.part.add(pos=np.random.random((500, 3)) * 10.)
+        system.integrator.run(200)
+        self.assertGreater(system.time_step, 0.015)
+        v2 = 0.
+        for _ in range(100):
+            system.integrator.run(2)
+            v2 += np.mean(np.square(partcls.v))
+        self.assertAlmostEqual(v2 / 100. / kT, 1., delta=0.05)
+
+
+if __name__ == "__main__":
+    ut.main()
@@ -0,0 +1,120 @@
+#
+# Copyright (C) 2020-2022 The ESPResSo project
+#
+# This file is part of ESPResSo.
+#
+# ESPResSo is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ESPResSo is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+import espressomd
+import unittest as ut
+import unittest_decorators as utx
+import numpy as np
+
+import espressomd
+import espressomd.interactions
+
+
+class IntegratorBAOAB(ut.TestCase):
+
+    """Tests the BAOAB Langevin integrator"""
+    system = espressomd.System(box_l=[10., 10., 10.])
+    system.cell_system.skin = 0.4
+
+    def setUp(self):
+        np.random.seed(42)
+
+    def tearDown(self):
+        self.system.part.clear()
+        self.system.bonded_inter.clear()
+        self.system.thermostat.turn_off()
+        self.system.integrator.set_vv()
+
+    def test_friction(self):
+        """The velocities of free particles decay exactly exponentially."""
+        system = self.system
+        system.time_step = 0.5
+        gamma = 0.4
+        v0 = np.array([1., -2., 3.])
+        p = system.part.add(pos=[1., 1., 1.], v=v0)
+        system.thermostat.set_langevin(kT=0., gamma=gamma, seed=42)
+        system.integrator.set_baoab()
+        self.assertIsInstance(system.integrator.integrator,
+                              espressomd.integrate.BAOABLangevin)
+        for i in range(1, 6):
+            system.integrator.run(1)
+            t = i * system.time_step
+            np.testing.assert_allclose(
+                np.copy(p.v), v0 * np.exp(-gamma * t), rtol=1e-12)
+        # the thermostat forces are not added to the particle forces
+        np.testing.assert_allclose(np.copy(p.f), 0., atol=1e-12)
+
+    def sample_harmonic_traps(self, setup_integrator):
+        """Sample the position variance of particles tethered by harmonic
+        bonds to fixed anchors, at a large time step."""
+        system = self.system
+        system.time_step = 0.5
+        kT = 1.2
+        k = 1.5
+        n_part = 300
+        harmonic = espressomd.interactions.HarmonicBond(k=k, r_0=0.)
+        system.bonded_inter.add(harmonic)
+        anchors = system.part.add(
+            pos=np.random.random((n_part, 3)) * system.box_l,
+            fix=n_part * [3 * [True]])
+        partcls = system.part.add(pos=anchors.pos)
+        for p, anchor in zip(partcls, anchors):
+            p.add_bond((harmonic, anchor))
+        system.thermostat.set_langevin(kT=kT, gamma=1., seed=42)
+        setup_integrator()
+        system.integrator.run(100)
+        variance = 0.
+        n_samples = 200
+        for _ in range(n_samples):
+            system.integrator.run(5)
+            dist = partcls.pos - anchors.pos
+            variance += np.mean(np.square(dist))
+        return variance / n_samples * k / kT
+
+    def test_configurational_sampling(self):
+        """BAOAB samples the configurations of a harmonic oscillator exactly
+        for any stable time step, unlike velocity Verlet with Langevin forces.
+        """
+        def set_baoab():
+            self.system.integrator.set_baoab()
+
+        ratio_baoab = self.sample_harmonic_traps(set_baoab)
+        self.tearDown()
+        ratio_vv = self.sample_harmonic_traps(self.system.integrator.set_vv)
+        self.assertAlmostEqual(ratio_baoab, 1., delta=0.04)
+        self.assertGreater(abs(ratio_vv - 1.), 3. * abs(ratio_baoab - 1.))
+
+    @utx.skipIfMissingFeatures(["THERMOSTAT_PER_PARTICLE",
+                                "PARTICLE_ANISOTROPY"])
+    def test_per_particle_gamma(self):
+        """Per-particle anisotropic friction is applied in the body frame."""
+        system = self.system
+        system.time_step = 0.5
+        gamma = np.array([0.2, 0.4, 0.8])
+        v0 = np.array([1., -2., 3.])
+        p = system.part.add(pos=[1., 1., 1.], v=v0, gamma=gamma)
+        system.thermostat.set_langevin(kT=0., gamma=1., seed=42)
+        system.integrator.set_baoab()
+        system.integrator.run(4)
+        t = 4 * system.time_step
+        np.testing.assert_allclose(
+            np.copy(p.v), v0 * np.exp(-gamma * t), rtol=1e-12)
+
+
+if __name__ == "__main__":
+    ut.main()
@@ -17,6 +17,7 @@
 # along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #
 import espressomd
+import espressomd.integrate
 import espressomd.interactions
 import espressomd.lees_edwards
 import espressomd.shapes
@@ -74,6 +75,13 @@ class Test(ut.TestCase):
         with self.assertRaisesRegex(Exception, self.msg + 'The VV integrator is incompatible with the currently active combination of thermostats'):
             self.system.integrator.run(0)
 
+    def test_baoab_integrator(self):
+        self.system.cell_system.skin = 0.4
+        self.system.thermostat.set_brownian(kT=1.0, gamma=1.0, seed=42)
+        self.system.integrator.set_baoab()
+        with self.assertRaisesRegex(Exception, self.msg + 'The BAOAB integrator is incompatible with the currently active combination of thermostats'):
+            self.system.integrator.run(0)
+
     def test_brownian_integrator(self):
         self.system.cell_system.skin = 0.4
         self.system.integrator.set_brownian_dynamics()
@@ -126,6 +134,18 @@ class Test(ut.TestCase):
         with self.assertRaisesRegex(Exception, self.msg + 'The steepest descent integrator is incompatible with thermostats'):
             self.system.integrator.run(0)
 
+    def test_adaptive_time_step(self):
+        self.system.cell_system.skin = 0.4
+        self.system.integrator.adaptive_time_step = espressomd.integrate.AdaptiveTimeStep(
+            max_displacement=0.1, time_step_min=1e-4, time_step_max=0.1)
+        self.system.integrator.set_steepest_descent(
+            f_max=0, gamma=0.1, max_displacement=0.1)
+        with self.assertRaisesRegex(Exception, self.msg + 'Adaptive time steps are only supported by the VV and BAOAB integrators'):
+            self.system.integrator.run(0)
+        self.system.integrator.set_vv()
+        self.system.integrator.run(0)
+        self.system.integrator.adaptive_time_step = None
+
 
 if __name__ == "__main__":
     ut.main()
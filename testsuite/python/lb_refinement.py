@@ -0,0 +1,170 @@
+#
+# Copyright (C) 2022 The ESPResSo project
+#
+# This file is part of ESPResSo.
+#
+# ESPResSo is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ESPResSo is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+import unittest as ut
+import unittest_decorators as utx
+import numpy as np
+
+import espressomd
+import espressomd.lb
+import espressomd.lbboundaries
+import espressomd.shapes
+
+AGRID = 1.
+EXT_FORCE = 1e-3
+VISC = 5.
+DENS = 1.
+TIME_STEP = 0.05
+LB_PARAMS = {'agrid': AGRID,
+             'dens': DENS,
+             'visc': VISC,
+             'tau': TIME_STEP}
+
+
+class LBRefinement(ut.TestCase):
+
+    """
+    Check the static grid refinement of the CPU lattice-Boltzmann fluid.
+    """
+
+    system = espressomd.System(box_l=[12., 8., 8.])
+    system.time_step = TIME_STEP
+    system.cell_system.skin = 0.4 * AGRID
+
+    def tearDown(self):
+        self.system.actors.clear()
+        self.system.lbboundaries.clear()
+        self.system.part.clear()
+        self.system.thermostat.turn_off()
+
+    def add_lb(self, **kwargs):
+        lbf = espressomd.lb.LBFluid(**LB_PARAMS, **kwargs)
+        self.system.actors.add(lbf)
+        return lbf
+
+    def add_walls(self):
+        wall1 = espressomd.shapes.Wall(normal=[1, 0, 0], dist=AGRID)
+        wall2 = espressomd.shapes.Wall(
+            normal=[-1, 0, 0], dist=-(self.system.box_l[0] - AGRID))
+        for shape in (wall1, wall2):
+            self.system.lbboundaries.add(
+                espressomd.lbboundaries.LBBoundary(shape=shape))
+
+    def total_mass(self, lbf):
+        shape = lbf.shape
+        return sum(lbf[i, j, k].density for i in range(shape[0])
+                   for j in range(shape[1]) for k in range(shape[2]))
+
+    def test_regions(self):
+        lbf = self.add_lb()
+        self.assertEqual(lbf.refinement_regions, [])
+        lbf.add_refinement_region([0, 0, 0], [4, 4, 4])
+        lbf.add_refinement_region([6, 2, 3], [11, 7, 7])
+        self.assertEqual(lbf.refinement_regions,
+                         [((0, 0, 0), (4, 4, 4)), ((6, 2, 3), (11, 7, 7))])
+        lbf.clear_refinement_regions()
+        self.assertEqual(lbf.refinement_regions, [])
+        # regions are removed together with the fluid
+        lbf.add_refinement_region([0, 0, 0], [4, 4, 4])
+        self.system.actors.remove(lbf)
+        self.assertEqual(lbf.refinement_regions, [])
+
+    def test_fluid_at_rest(self):
+        lbf = self.add_lb()
+        lbf.add_refinement_region([2, 2, 2], [9, 6, 6])
+        self.system.integrator.run(20)
+        for node in (lbf[1, 4, 4], lbf[5, 4, 4], lbf[9, 4, 4]):
+            np.testing.assert_allclose(
+                np.copy(node.velocity), [0., 0., 0.], atol=1e-12)
+            self.assertAlmostEqual(node.density, DENS, delta=1e-12)
+
+    @utx.skipIfMissingFeatures(['LB_BOUNDARIES', 'EXTERNAL_FORCES'])
+    def test_poiseuille(self):
+        """
+        Compare the velocity profile of a plane Poiseuille flow through
+        a refined region against the analytical solution.
+        """
+        lbf = self.add_lb(ext_force_density=[0., EXT_FORCE, 0.])
+        self.add_walls()
+        lbf.add_refinement_region([2, 2, 2], [9, 6, 6])
+        mass = self.total_mass(lbf)
+        self.system.integrator.run(800)
+
+        x = np.arange(1, lbf.shape[0] - 1) + 0.5
+        v_measured = [lbf[i, 4, 4].velocity[1] for i in range(1, 11)]
+        width = self.system.box_l[0] - 2. * AGRID
+        v_expected = EXT_FORCE / (2. * VISC * DENS) * \
+            (width**2 / 4. - (x - 0.5 * self.system.box_l[0])**2)
+        np.testing.assert_allclose(v_measured, v_expected,
+                                   atol=0.015 * np.max(v_expected))
+        # the fine lattice resolves the profile between the coarse nodes
+        v_fine = [lbf.get_interpolated_velocity([x, 4., 4.])[1]
+                  for x in (5.5, 6., 6.5)]
+        v_max = EXT_FORCE / (2. * VISC * DENS) * width**2 / 4.
+        self.assertGreater(v_fine[1], v_fine[0])
+        self.assertGreater(v_fine[1], v_fine[2])
+        self.assertAlmostEqual(v_fine[1] / v_max, 1., delta=0.01)
+        self.assertAlmostEqual(self.total_mass(lbf) / mass, 1., delta=1e-8)
+
+    def test_particle_coupling(self):
+        """
+        Check that a particle inside a refined region transfers its momentum
+        to the fluid. The coupling of the lattices is not exactly conservative
+        for flow fields that vary on the scale of the coarse lattice.
+        """
+        lbf = self.add_lb()
+        self.system.thermostat.set_lb(LB_fluid=lbf, gamma=1.)
+        lbf.add_refinement_region([2, 2, 2], [9, 6, 6])
+        p = self.system.part.add(pos=[5.6, 4.2, 3.9], v=[0., 0., 0.1])
+        momentum = np.copy(p.v * p.mass)
+        self.system.integrator.run(500)
+        self.assertLess(abs(p.v[2]), 0.01)
+        shape = lbf.shape
+        fluid_momentum = np.sum(
+            [lbf[i, j, k].velocity * lbf[i, j, k].density
+             for i in range(shape[0]) for j in range(shape[1])
+             for k in range(shape[2])], axis=0)
+        np.testing.assert_allclose(fluid_momentum + p.v * p.mass, momentum,
+                                   atol=0.05 * np.linalg.norm(momentum))
+
+    def test_exceptions(self):
+        lbf = self.add_lb()
+        with self.assertRaisesRegex(ValueError, "at least 4 lattice cells"):
+            lbf.add_refinement_region([2, 2, 2], [5, 6, 6])
+        with self.assertRaisesRegex(ValueError, "inside the lattice"):
+            lbf.add_refinement_region([-1, 2, 2], [5, 6, 6])
+        with self.assertRaisesRegex(ValueError, "inside the lattice"):
+            lbf.add_refinement_region([6, 2, 2], [12, 6, 6])
+        lbf.add_refinement_region([2, 2, 2], [6, 6, 6])
+        with self.assertRaisesRegex(ValueError, "must not overlap"):
+            lbf.add_refinement_region([6, 2, 2], [10, 6, 6])
+        self.assertEqual(len(lbf.refinement_regions), 1)
+        with self.assertRaisesRegex(ValueError, "integer list of length 3"):
+            lbf.add_refinement_region([2., 2., 2.], [6, 6, 6])
+
+    @utx.skipIfMissingFeatures(['LB_BOUNDARIES'])
+    def test_boundary_at_interface(self):
+        lbf = self.add_lb()
+        self.add_walls()
+        lbf.add_refinement_region([0, 2, 2], [9, 6, 6])
+        with self.assertRaisesRegex(Exception, "must not cross the interface"):
+            self.system.integrator.run(1)
+
+
+if __name__ == "__main__":
+    ut.main()
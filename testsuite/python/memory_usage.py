@@ -0,0 +1,132 @@
+#
+# Copyright (C) 2022 The ESPResSo project
+#
+# This file is part of ESPResSo.
+#
+# ESPResSo is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ESPResSo is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+import unittest as ut
+import unittest_decorators as utx
+import espressomd
+import espressomd.accumulators
+import espressomd.electrostatics
+import espressomd.lb
+import espressomd.observables
+import numpy as np
+
+
+class MemoryUsage(ut.TestCase):
+    """
+    Check the accounting of the heap memory of the subsystems.
+    """
+    system = espressomd.System(box_l=[10., 10., 10.])
+    system.time_step = 0.01
+    system.cell_system.skin = 0.4
+    n_nodes = system.cell_system.get_state()["n_nodes"]
+    subsystems = ("local_particles", "ghost_particles", "pair_lists",
+                  "particle_index", "type_map", "lb_fluid", "p3m", "dp3m",
+                  "fetch_cache", "accumulators")
+
+    def tearDown(self):
+        self.system.actors.clear()
+        self.system.auto_update_accumulators.clear()
+        self.system.part.clear()
+
+    def check_consistency(self, usage):
+        self.assertEqual(set(usage.keys()), set(self.subsystems + ("total",)))
+        for entry in usage.values():
+            self.assertLessEqual(entry["min"], entry["max"])
+            self.assertLessEqual(entry["max"], entry["sum"])
+            self.assertLessEqual(self.n_nodes * entry["min"], entry["sum"])
+            self.assertGreaterEqual(self.n_nodes * entry["max"], entry["sum"])
+        self.assertEqual(usage["total"]["sum"],
+                         sum(usage[key]["sum"] for key in self.subsystems))
+
+    def test_particles(self):
+        system = self.system
+        usage_ref = system.memory_usage()
+        self.check_consistency(usage_ref)
+        partcls = system.part.add(
+            pos=np.random.random((100, 3)) * system.box_l)
+        system.integrator.run(0)
+        usage = system.memory_usage()
+        self.check_consistency(usage)
+        for key in ("local_particles", "ghost_particles", "particle_index"):
+            self.assertGreater(usage[key]["sum"], usage_ref[key]["sum"])
+        if espressomd.has_features(["EXCLUSIONS"]):
+            p0, p1, p2 = system.part.by_ids(partcls.id[:3])
+            p0.add_exclusion(p1.id)
+            p0.add_exclusion(p2.id)
+            system.integrator.run(0)
+            usage_excl = system.memory_usage()
+            self.assertGreater(usage_excl["local_particles"]["sum"],
+                               usage["local_particles"]["sum"])
+
+    def test_type_map(self):
+        system = self.system
+        system.part.add(pos=np.random.random((10, 3)) * system.box_l,
+                        type=[7] * 10)
+        usage_ref = system.memory_usage()
+        system.setup_type_map(type_list=[7])
+        usage = system.memory_usage()
+        self.check_consistency(usage)
+        self.assertGreater(usage["type_map"]["sum"],
+                           usage_ref["type_map"]["sum"])
+
+    def test_accumulators(self):
+        system = self.system
+        system.part.add(pos=[[0., 0., 0.]])
+        obs = espressomd.observables.ParticlePositions(ids=[0])
+        acc = espressomd.accumulators.TimeSeries(obs=obs, delta_N=1)
+        system.auto_update_accumulators.add(acc)
+        system.integrator.run(10)
+        usage_ref = system.memory_usage()
+        system.integrator.run(100)
+        usage = system.memory_usage()
+        self.check_consistency(usage)
+        self.assertGreater(usage["accumulators"]["sum"],
+                           usage_ref["accumulators"]["sum"])
+        system.auto_update_accumulators.clear()
+        usage = system.memory_usage()
+        self.assertEqual(usage["accumulators"]["sum"], 0)
+
+    @utx.skipIfMissingFeatures(["P3M"])
+    def test_p3m(self):
+        system = self.system
+        system.part.add(pos=[[1., 1., 1.], [2., 2., 2.]], q=[1., -1.])
+        p3m = espressomd.electrostatics.P3M(
+            prefactor=1., accuracy=1e-3, mesh=[16, 16, 16], cao=3, r_cut=1.,
+            alpha=3., tune=False)
+        system.actors.add(p3m)
+        usage = system.memory_usage()
+        self.check_consistency(usage)
+        # the real-space mesh and the three field meshes hold at least
+        # the whole mesh over all ranks
+        self.assertGreaterEqual(usage["p3m"]["sum"], 4 * 8 * 16**3)
+        system.actors.clear()
+        usage = system.memory_usage()
+        self.assertEqual(usage["p3m"]["sum"], 0)
+
+    def test_lb(self):
+        system = self.system
+        lbf = espressomd.lb.LBFluid(agrid=1., dens=1., visc=1., tau=0.01)
+        system.actors.add(lbf)
+        usage = system.memory_usage()
+        self.check_consistency(usage)
+        # two copies of the 19 populations on the whole lattice
+        self.assertGreaterEqual(usage["lb_fluid"]["sum"], 2 * 19 * 8 * 10**3)
+
+
+if __name__ == "__main__":
+    ut.main()
@@ -0,0 +1,97 @@
+#
+# Copyright (C) 2022 The ESPResSo project
+#
+# This file is part of ESPResSo.
+#
+# ESPResSo is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ESPResSo is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+import unittest as ut
+import unittest_decorators as utx
+import espressomd
+import numpy as np
+
+
+@utx.skipIfMissingFeatures(["LENNARD_JONES", "WCA"])
+class MixedPrecision(ut.TestCase):
+    """
+    Check the mixed-precision short-range force mode against the
+    double-precision force kernels, and validate the energy drift
+    of a microcanonical Lennard-Jones/WCA fluid.
+    """
+    system = espressomd.System(box_l=[8., 8., 8.])
+    system.time_step = 0.002
+    system.cell_system.skin = 0.4
+
+    def setUp(self):
+        self.system.non_bonded_inter[0, 0].lennard_jones.set_params(
+            epsilon=1., sigma=1., cutoff=2.5, shift="auto")
+        self.system.non_bonded_inter[0, 1].wca.set_params(
+            epsilon=1., sigma=1.)
+        np.random.seed(42)
+        n_part = 300
+        self.system.part.add(pos=np.random.random((n_part, 3)) * 8.,
+                             type=np.random.randint(0, 2, n_part))
+        self.system.integrator.set_steepest_descent(
+            f_max=0., gamma=0.1, max_displacement=0.05)
+        self.system.integrator.run(100)
+        self.system.integrator.set_vv()
+        self.system.part.all().v = np.random.normal(size=(n_part, 3))
+
+    def tearDown(self):
+        self.system.part.clear()
+        self.system.non_bonded_inter[0, 0].lennard_jones.deactivate()
+        self.system.non_bonded_inter[0, 1].wca.deactivate()
+        self.system.cell_system.use_mixed_precision = False
+
+    def get_total_energy(self):
+        return self.system.analysis.energy()["total"]
+
+    def get_energy_drift(self, n_steps):
+        energies = []
+        for _ in range(n_steps):
+            self.system.integrator.run(10)
+            energies.append(self.get_total_energy())
+        return np.ptp(energies) / np.abs(np.mean(energies))
+
+    def test_forces(self):
+        self.assertFalse(self.system.cell_system.use_mixed_precision)
+        self.system.integrator.run(0, recalc_forces=True)
+        ref_forces = np.copy(self.system.part.all().f)
+        self.system.cell_system.use_mixed_precision = True
+        self.assertTrue(self.system.cell_system.use_mixed_precision)
+        self.system.integrator.run(0, recalc_forces=True)
+        forces = np.copy(self.system.part.all().f)
+        # single precision is sufficient for the relative accuracy
+        np.testing.assert_allclose(
+            forces, ref_forces, rtol=0., atol=1e-5 * np.max(np.abs(ref_forces)))
+        # forces are not identical to the double-precision kernels
+        self.assertFalse(np.array_equal(forces, ref_forces))
+
+    def test_energy_drift(self):
+        partcls = self.system.part.all()
+        pos = np.copy(partcls.pos)
+        vel = np.copy(partcls.v)
+        ref_drift = self.get_energy_drift(40)
+        # integrate the same trajectory in mixed precision
+        partcls.pos = pos
+        partcls.v = vel
+        self.system.cell_system.use_mixed_precision = True
+        drift = self.get_energy_drift(40)
+        self.assertLess(drift, 1e-3)
+        self.assertLess(drift, 1.1 * ref_drift)
+
+
+if __name__ == "__main__":
+    ut.main()
@@ -99,6 +99,72 @@ class FFT_test(ut.TestCase):
             self.system.actors.clear()
             np.testing.assert_allclose(p3m_energy, ref_energy, rtol=1e-4)
 
+    @ut.skipIf(n_nodes not in FFT_PLANS, f"no FFT plan for {n_nodes} threads")
+    def test_kspace_ranks(self):
+        import espressomd.electrostatics
+        self.add_charged_particles()
+        node_grid, params = FFT_PLANS[self.n_nodes][0]
+        self.system.cell_system.node_grid = node_grid
+        p3m_params = dict(prefactor=2, accuracy=1e-6, **params)
+        solver = espressomd.electrostatics.P3M(tune=False, **p3m_params)
+        self.system.actors.add(solver)
+        self.system.integrator.run(0, recalc_forces=True)
+        ref_energy = self.system.analysis.energy()['coulomb']
+        ref_forces = np.copy(self.system.part.all().f)
+        self.system.actors.clear()
+        divisors = [n for n in range(1, self.n_nodes + 1)
+                    if self.n_nodes % n == 0]
+        for kspace_ranks in divisors:
+            solver = espressomd.electrostatics.P3M(
+                tune=False, kspace_ranks=kspace_ranks, **p3m_params)
+            self.system.actors.add(solver)
+            self.assertEqual(solver.kspace_ranks, kspace_ranks)
+            self.system.integrator.run(0, recalc_forces=True)
+            p3m_energy = self.system.analysis.energy()['coulomb']
+            p3m_forces = np.copy(self.system.part.all().f)
+            self.system.actors.clear()
+            np.testing.assert_allclose(p3m_energy, ref_energy, rtol=1e-10)
+            np.testing.assert_allclose(p3m_forces, ref_forces, atol=1e-10)
+        # let the tuning algorithm choose the number of ranks
+        solver = espressomd.electrostatics.P3M(
+            prefactor=2, accuracy=1e-3, mesh=params['mesh'], cao=params['cao'],
+            r_cut=params['r_cut'], kspace_ranks=-1, verbose=False, timings=3)
+        self.system.actors.add(solver)
+        self.assertIn(solver.kspace_ranks, [0] + divisors[:-1])
+        self.system.actors.clear()
+        # invalid number of ranks
+        solver = espressomd.electrostatics.P3M(
+            tune=False, kspace_ranks=self.n_nodes + 1, **p3m_params)
+        with self.assertRaisesRegex(Exception, "parameter 'kspace_ranks' must be a divisor of the number of MPI ranks"):
+            self.system.actors.add(solver)
+        with self.assertRaisesRegex(ValueError, "Parameter 'kspace_ranks' must be >= 0"):
+            espressomd.electrostatics.P3M(
+                tune=False, kspace_ranks=-1, **p3m_params)
+
+    @ut.skipIf(n_nodes not in FFT_PLANS, f"no FFT plan for {n_nodes} threads")
+    def test_fft_decomposition(self):
+        import espressomd.electrostatics
+        self.add_charged_particles()
+        for node_grid, params in FFT_PLANS[self.n_nodes]:
+            self.system.cell_system.node_grid = node_grid
+            p3m_params = dict(prefactor=2, accuracy=1e-6, tune=False, **params)
+            results = []
+            for fft_decomposition in ["pencil", "slab", "auto"]:
+                solver = espressomd.electrostatics.P3M(
+                    fft_decomposition=fft_decomposition, **p3m_params)
+                self.system.actors.add(solver)
+                self.assertEqual(solver.fft_decomposition, fft_decomposition)
+                self.system.integrator.run(0, recalc_forces=True)
+                results.append((self.system.analysis.energy()['coulomb'],
+                                np.copy(self.system.part.all().f)))
+                self.system.actors.clear()
+            for energy, forces in results[1:]:
+                np.testing.assert_allclose(energy, results[0][0], rtol=1e-10)
+                np.testing.assert_allclose(forces, results[0][1], atol=1e-10)
+        with self.assertRaisesRegex(ValueError, "Parameter 'fft_decomposition' must be one of 'auto', 'slab', 'pencil'"):
+            espressomd.electrostatics.P3M(
+                fft_decomposition="cube", **p3m_params)
+
     @utx.skipIfMissingFeatures("P3M")
     @ut.skipIf(n_nodes < 2 or n_nodes >= 8, "only runs for 2 <= n_nodes <= 7")
     def test_unsorted_node_grid_exception_p3m(self):
@@ -0,0 +1,155 @@
+#
+# Copyright (C) 2022 The ESPResSo project
+#
+# This file is part of ESPResSo.
+#
+# ESPResSo is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ESPResSo is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+import espressomd
+import espressomd.electrostatics
+import espressomd.magnetostatics
+import numpy as np
+import unittest as ut
+import unittest_decorators as utx
+
+
+class Test(ut.TestCase):
+    """
+    Check the accuracy monitoring of P3M and dipolar P3M, which adapts the
+    parameters during the integration when the error estimate drifts away
+    from the target accuracy.
+    """
+
+    system = espressomd.System(box_l=[10., 10., 10.])
+    system.time_step = 1e-5
+    system.cell_system.skin = 0.2
+    n_part = 300
+    accuracy = 1e-3
+
+    def setUp(self):
+        self.system.box_l = [10., 10., 10.]
+        np.random.seed(42)
+        self.system.part.add(
+            pos=np.random.random((self.n_part, 3)) * self.system.box_l)
+
+    def tearDown(self):
+        self.system.actors.clear()
+        self.system.part.clear()
+
+    def get_params(self, solver):
+        params = solver.get_params()
+        return {"alpha": params["alpha"], "r_cut": params["r_cut"],
+                "mesh": list(params["mesh"]), "cao": params["cao"]}
+
+    def calc_forces(self):
+        # invalidate the forces
+        self.system.part.all().pos = self.system.part.all().pos
+        self.system.integrator.run(0)
+        return np.copy(self.system.part.all().f)
+
+    def rms_force_error(self, solver, accurate_solver):
+        forces = self.calc_forces()
+        self.system.actors.remove(solver)
+        self.system.actors.add(accurate_solver)
+        ref_forces = self.calc_forces()
+        self.system.actors.remove(accurate_solver)
+        self.system.actors.add(solver)
+        return np.sqrt(np.sum(np.square(forces - ref_forces)) / self.n_part)
+
+    def check_retune(self, solver, accurate_solver, scale_moments):
+        retune_interval = solver.retune_interval
+        self.system.actors.add(solver)
+        params_tuned = self.get_params(solver)
+
+        # the error estimate doesn't drift: the parameters are kept
+        self.system.integrator.run(2 * retune_interval)
+        self.assertEqual(self.get_params(solver), params_tuned)
+
+        # larger moments increase the error, which triggers a retuning
+        scale_moments(3.)
+        error_before = self.rms_force_error(solver, accurate_solver)
+        self.assertGreater(error_before, 2. * self.accuracy)
+        self.system.integrator.run(retune_interval - 1)
+        self.assertEqual(self.get_params(solver), params_tuned)
+        self.system.integrator.run(1)
+        params_retuned = self.get_params(solver)
+        self.assertEqual(params_retuned["cao"], params_tuned["cao"])
+        self.assertGreater(params_retuned["r_cut"], params_tuned["r_cut"])
+        self.assertLessEqual(solver.accuracy, self.accuracy)
+        error_after = self.rms_force_error(solver, accurate_solver)
+        self.assertLess(error_after, 2. * self.accuracy)
+        self.assertLess(error_after, error_before / 2.)
+
+        # smaller moments decrease the error, the cutoff is reduced again
+        scale_moments(1. / 3.)
+        self.system.integrator.run(retune_interval)
+        self.assertLess(solver.r_cut, params_retuned["r_cut"])
+        self.assertLessEqual(solver.accuracy, self.accuracy)
+        self.assertGreater(solver.accuracy, self.accuracy / 2.)
+
+    @utx.skipIfMissingFeatures(["P3M"])
+    def test_p3m(self):
+        partcls = self.system.part.all()
+        partcls.q = np.resize([-1., 1.], self.n_part)
+
+        def scale_moments(factor):
+            partcls.q = factor * partcls.q
+
+        solver = espressomd.electrostatics.P3M(
+            prefactor=1., accuracy=self.accuracy, mesh=16, cao=5,
+            verbose=False, retune_interval=4, retune_tolerance=1.5)
+        accurate_solver = espressomd.electrostatics.P3M(
+            prefactor=1., accuracy=1e-6, mesh=32, cao=7, r_cut=4.,
+            alpha=1.05, tune=False)
+        self.check_retune(solver, accurate_solver, scale_moments)
+
+    @utx.skipIfMissingFeatures(["P3M"])
+    def test_p3m_box_change(self):
+        partcls = self.system.part.all()
+        partcls.q = np.resize([-1., 1.], self.n_part)
+        solver = espressomd.electrostatics.P3M(
+            prefactor=1., accuracy=self.accuracy, mesh=16, cao=5,
+            verbose=False, retune_interval=1, retune_tolerance=1.5)
+        self.system.actors.add(solver)
+        r_cut_iL = solver.r_cut_iL
+        # a larger volume at constant number of charges decreases the error
+        # at fixed rescaled parameters
+        self.system.change_volume_and_rescale_particles(14.)
+        self.assertAlmostEqual(solver.r_cut_iL, r_cut_iL, delta=1e-10)
+        self.system.integrator.run(1)
+        self.assertLess(solver.r_cut_iL, r_cut_iL)
+        self.assertLessEqual(solver.accuracy, self.accuracy)
+        self.assertGreater(solver.accuracy, self.accuracy / 2.)
+
+    @utx.skipIfMissingFeatures(["DP3M"])
+    def test_dp3m(self):
+        partcls = self.system.part.all()
+        dip = np.random.random((self.n_part, 3)) - 0.5
+        partcls.dip = dip / np.linalg.norm(dip, axis=1)[:, np.newaxis]
+
+        def scale_moments(factor):
+            partcls.dip = factor * partcls.dip
+
+        solver = espressomd.magnetostatics.DipolarP3M(
+            prefactor=1., accuracy=self.accuracy, mesh=16, cao=5,
+            verbose=False, retune_interval=4, retune_tolerance=1.5)
+        accurate_solver = espressomd.magnetostatics.DipolarP3M(
+            prefactor=1., accuracy=1e-6, mesh=32, cao=7, r_cut=4.,
+            alpha=1.05, tune=False)
+        self.check_retune(solver, accurate_solver, scale_moments)
+
+
+if __name__ == "__main__":
+    ut.main()
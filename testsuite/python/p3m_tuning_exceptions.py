@@ -201,6 +201,8 @@ class Test(ut.TestCase):
             ('mesh', (-1, -1, -1), "Parameter 'mesh' must be > 0"),
             ('mesh', (2, 2, 2), "Parameter 'cao' cannot be larger than 'mesh'"),
             ('mesh_off', (-2, 1, 1), "Parameter 'mesh_off' must be >= 0 and <= 1"),
+            ('retune_interval', -1, "Parameter 'retune_interval' must be >= 0"),
+            ('retune_tolerance', 1., "Parameter 'retune_tolerance' must be > 1"),
         ]
         if class_solver is espressomd.magnetostatics.DipolarP3M:
             invalid_params.append(
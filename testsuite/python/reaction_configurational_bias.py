@@ -0,0 +1,83 @@
+#
+# Copyright (C) 2022 The ESPResSo project
+#
+# This file is part of ESPResSo.
+#
+# ESPResSo is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ESPResSo is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+import unittest as ut
+import unittest_decorators as utx
+
+import espressomd
+import espressomd.reaction_methods
+import numpy as np
+
+
+@utx.skipIfMissingFeatures(["LENNARD_JONES"])
+class ReactionConfigurationalBiasTest(ut.TestCase):
+    """
+    Test the configurational-bias insertion of reaction products in a
+    grand canonical simulation of WCA ion pairs: the equilibrium particle
+    number must not depend on the number of trial positions.
+    """
+    types = {"A": 0, "B": 1}
+    gamma = 8.
+
+    system = espressomd.System(box_l=3 * [6.])
+    system.cell_system.skin = 0.4
+    system.time_step = 0.01
+    for type_1 in types.values():
+        for type_2 in types.values():
+            system.non_bonded_inter[type_1, type_2].lennard_jones.set_params(
+                epsilon=1., sigma=1., cutoff=2**(1. / 6.), shift="auto")
+
+    def make_method(self, number_of_trial_positions):
+        method = espressomd.reaction_methods.ReactionEnsemble(
+            kT=1., exclusion_range=0., seed=42,
+            number_of_trial_positions=number_of_trial_positions)
+        method.add_reaction(
+            gamma=self.gamma, reactant_types=[], reactant_coefficients=[],
+            product_types=[self.types["A"], self.types["B"]],
+            product_coefficients=[1, 1],
+            default_charges={self.types["A"]: 0, self.types["B"]: 0})
+        method.set_non_interacting_type(type=len(self.types))
+        return method
+
+    def sample_particle_number(self, method):
+        samples = []
+        for _ in range(800):
+            method.reaction(steps=10)
+            samples.append(self.system.number_of_particles(
+                type=self.types["A"]))
+            self.assertEqual(
+                self.system.number_of_particles(type=self.types["B"]),
+                samples[-1])
+        return np.mean(samples)
+
+    def test_equilibrium_particle_number(self):
+        # equilibrate with the biased insertion, which converges faster
+        method_cbmc = self.make_method(4)
+        method_cbmc.reaction(steps=1000)
+        n_cbmc = self.sample_particle_number(method_cbmc)
+        method_ref = self.make_method(1)
+        n_ref = self.sample_particle_number(method_ref)
+        self.assertAlmostEqual(n_cbmc / n_ref, 1., delta=0.05)
+        self.assertGreater(
+            method_cbmc.get_acceptance_rate_reaction(reaction_id=0),
+            3. * method_ref.get_acceptance_rate_reaction(reaction_id=0))
+
+
+if __name__ == "__main__":
+    ut.main()
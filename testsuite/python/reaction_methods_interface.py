@@ -94,6 +94,9 @@ class ReactionMethods(ut.TestCase):
             self.assertAlmostEqual(
                 method.exclusion_radius_per_type[2], 0.2, delta=1e-10)
             exclusion_radius_per_type = {2: 0.2}
+            self.assertEqual(method.number_of_trial_positions, 1)
+            method.number_of_trial_positions = 4
+            self.assertEqual(method.number_of_trial_positions, 4)
         self.assertAlmostEqual(
             method.get_volume(), self.system.volume(), delta=1e-10)
         method.set_volume(volume=1.)
@@ -310,6 +313,8 @@ class ReactionMethods(ut.TestCase):
             widom.calculate_particle_insertion_potential_energy(reaction_id=0)
         with self.assertRaisesRegex(RuntimeError, "No search algorithm for WidomInsertion"):
             widom.search_algorithm = "order_n"
+        with self.assertRaisesRegex(RuntimeError, "No configurational bias for WidomInsertion"):
+            widom.number_of_trial_positions = 2
 
         # check other exceptions
         with self.assertRaisesRegex(ValueError, "Invalid value for 'volume'"):
@@ -360,6 +365,12 @@ class ReactionMethods(ut.TestCase):
         with self.assertRaisesRegex(ValueError, "Invalid excluded_radius value for type 2: radius -0.10"):
             method.exclusion_radius_per_type = {2: -0.1}
         self.assertEqual(list(method.exclusion_radius_per_type.keys()), [1])
+        with self.assertRaisesRegex(ValueError, "Invalid value for 'number_of_trial_positions'"):
+            espressomd.reaction_methods.ReactionEnsemble(
+                kT=1., seed=12, exclusion_range=1., number_of_trial_positions=0)
+        with self.assertRaisesRegex(ValueError, "Invalid value for 'number_of_trial_positions'"):
+            method.number_of_trial_positions = -1
+        self.assertEqual(method.number_of_trial_positions, 1)
 
 
 if __name__ == "__main__":
@@ -21,6 +21,7 @@ import unittest as ut
 import unittest_generator as utg
 import numpy as np
 import pathlib
+import tempfile
 
 import espressomd
 import espressomd.checkpointing
@@ -405,7 +406,8 @@ if espressomd.has_features("H5MD"):
     checkpoint.register("h5_units")
 
 # save checkpoint file
-checkpoint.save(0)
+checkpoint.save(0, asynchronous=True)
+checkpoint.wait()
 
 
 class TestCheckpoint(ut.TestCase):
@@ -425,6 +427,22 @@ class TestCheckpoint(ut.TestCase):
             self.assertTrue(lbf_cpt_path.is_file(),
                             "LB checkpoint file not created")
 
+        self.assertFalse(checkpoint.is_saving())
+        self.assertFalse(
+            (path_cpt_root / "0.checkpoint.__tmp__").exists())
+
+        # errors of asynchronous checkpoints are raised when waiting
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            invalid_checkpoint = espressomd.checkpointing.Checkpoint(
+                checkpoint_id="invalid", checkpoint_path=tmp_dir)
+            invalid_checkpoint.checkpoint_dir = str(
+                pathlib.Path(tmp_dir) / "unknown_dir")
+            invalid_checkpoint.save(asynchronous=True)
+            with self.assertRaisesRegex(RuntimeError, "Failed to write checkpoint file"):
+                invalid_checkpoint.wait()
+            invalid_checkpoint.wait()
+            self.assertFalse(invalid_checkpoint.is_saving())
+
         # only objects at global scope can be checkpointed
         with self.assertRaisesRegex(KeyError, "The given object 'local_obj' was not found in the current scope"):
             local_obj = "local"  # pylint: disable=unused-variable
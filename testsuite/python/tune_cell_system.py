@@ -0,0 +1,97 @@
+#
+# Copyright (C) 2022 The ESPResSo project
+#
+# This file is part of ESPResSo.
+#
+# ESPResSo is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ESPResSo is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+import unittest as ut
+import unittest_decorators as utx
+import espressomd
+import numpy as np
+
+
+@utx.skipIfMissingFeatures("LENNARD_JONES")
+class TuneCellSystem(ut.TestCase):
+    system = espressomd.System(box_l=[6., 6., 6.])
+    system.time_step = 0.01
+    system.cell_system.skin = 0.2
+
+    def setUp(self):
+        self.system.non_bonded_inter[0, 0].lennard_jones.set_params(
+            epsilon=1., sigma=1., cutoff=2**(1. / 6.), shift="auto")
+        np.random.seed(42)
+        self.system.part.add(pos=np.random.random((50, 3)) * 6.)
+        self.system.integrator.set_steepest_descent(
+            f_max=0., gamma=0.1, max_displacement=0.1)
+        self.system.integrator.run(20)
+        self.system.integrator.set_vv()
+
+    def tearDown(self):
+        self.system.part.clear()
+        self.system.cell_system.set_regular_decomposition()
+        self.system.cell_system.cell_size_factor = 1.
+
+    def test_tune(self):
+        params = self.system.cell_system.tune(
+            int_steps=5, cell_size_factors=[1., 1.5], skins=[0.1, 0.2])
+        self.assertIn(params["decomposition_type"],
+                      ("regular_decomposition", "n_square"))
+        self.assertIn(params["cell_size_factor"], (1., 1.5))
+        self.assertIn(params["skin"], (0.1, 0.2))
+        self.assertEqual(params["decomposition_type"],
+                         self.system.cell_system.decomposition_type)
+        self.assertEqual(params["use_verlet_lists"],
+                         self.system.cell_system.use_verlet_lists)
+        self.assertAlmostEqual(self.system.cell_system.skin, params["skin"],
+                               delta=1e-12)
+
+    def test_cell_size_factor(self):
+        cell_size = self.system.cell_system.get_state()["cell_size"]
+        self.system.cell_system.cell_size_factor = 2.
+        new_cell_size = self.system.cell_system.get_state()["cell_size"]
+        self.assertTrue(np.all(new_cell_size > cell_size))
+        self.assertTrue(np.all(new_cell_size >= 2. *
+                        self.system.cell_system.interaction_range))
+        with self.assertRaisesRegex(ValueError, "Parameter 'cell_size_factor' must be >= 1"):
+            self.system.cell_system.cell_size_factor = 0.5
+        with self.assertRaisesRegex(ValueError, "Parameter 'cell_size_factors' must be >= 1"):
+            self.system.cell_system.tune(int_steps=1, cell_size_factors=[0.5])
+        with self.assertRaisesRegex(ValueError, "Unknown decomposition 'unknown'"):
+            self.system.cell_system.tune(int_steps=1, decompositions=["unknown"])
+
+    def test_density_change(self):
+        self.system.cell_system.tune(
+            int_steps=2, decompositions=["regular_decomposition"],
+            cell_size_factors=[1.], use_verlet_lists=[True],
+            density_tolerance=0.1)
+        self.system.cell_system.use_verlet_lists = False
+        # no retuning without density change
+        self.system.integrator.run(1)
+        self.assertFalse(self.system.cell_system.use_verlet_lists)
+        # retuning is triggered by the density change and selects
+        # the only candidate
+        self.system.part.add(pos=np.random.random((10, 3)) * 6., type=10 * [1])
+        self.system.integrator.run(0)
+        self.assertFalse(self.system.cell_system.use_verlet_lists)
+        self.system.integrator.run(1)
+        self.assertTrue(self.system.cell_system.use_verlet_lists)
+        # disable automatic retuning
+        self.system.cell_system.tune(
+            int_steps=1, decompositions=["regular_decomposition"],
+            cell_size_factors=[1.], use_verlet_lists=[True])
+
+if __name__ == "__main__":
+    ut.main()